@@ -0,0 +1,70 @@
+# Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+#
+# Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+# or copy at http://opensource.org/licenses/MIT)
+#
+# Embed font files into the binary, to be opened with gltext::Font(apData, aSize) without any file I/O:
+#
+#   gltext_embed_fonts(FONT_SOURCES fonts/DejaVuSans.ttf fonts/DejaVuSerif.ttf)
+#   add_executable(kiosk main.cpp ${FONT_SOURCES})
+#
+# For each font file, a source file defining a read-only byte array is generated at build time,
+# along with a header declaring it, both named after the font file:
+#
+#   #include <DejaVuSans_ttf.h>
+#   gltext::Font font(DejaVuSans_ttf, DejaVuSans_ttf_size, 24);
+#
+# This file is also the script generating the sources, when run with "cmake -P".
+
+if (CMAKE_SCRIPT_MODE_FILE)
+    # Script mode: generate GLTEXT_EMBED_SOURCE and GLTEXT_EMBED_HEADER from GLTEXT_EMBED_FONT
+    file(READ "${GLTEXT_EMBED_FONT}" HEX_CONTENT HEX)
+    # 16 bytes (32 hex digits) per line, then each byte as a C literal
+    set(LINE_PATTERN "")
+    foreach (I RANGE 1 32)
+        set(LINE_PATTERN "${LINE_PATTERN}[0-9a-f]")
+    endforeach ()
+    string(REGEX REPLACE "(${LINE_PATTERN})" "\\1\n" HEX_CONTENT "${HEX_CONTENT}")
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," HEX_CONTENT "${HEX_CONTENT}")
+    file(WRITE "${GLTEXT_EMBED_HEADER}"
+         "// Generated by gltext_embed_fonts() from ${GLTEXT_EMBED_FONT}\n"
+         "#pragma once\n"
+         "#include <cstddef>\n"
+         "extern const unsigned char ${GLTEXT_EMBED_SYMBOL}[];\n"
+         "extern const size_t ${GLTEXT_EMBED_SYMBOL}_size;\n")
+    file(WRITE "${GLTEXT_EMBED_SOURCE}"
+         "// Generated by gltext_embed_fonts() from ${GLTEXT_EMBED_FONT}\n"
+         "#include \"${GLTEXT_EMBED_SYMBOL}.h\"\n"
+         "const unsigned char ${GLTEXT_EMBED_SYMBOL}[] = {\n${HEX_CONTENT}\n};\n"
+         "const size_t ${GLTEXT_EMBED_SYMBOL}_size = sizeof(${GLTEXT_EMBED_SYMBOL});\n")
+    return()
+endif ()
+
+set(GLTEXT_EMBED_FONTS_SCRIPT "${CMAKE_CURRENT_LIST_FILE}")
+
+# gltext_embed_fonts(<sources_variable> <font_file>...)
+function(gltext_embed_fonts SOURCES_VARIABLE)
+    set(OUTPUT_DIR "${CMAKE_CURRENT_BINARY_DIR}/gltext_fonts")
+    file(MAKE_DIRECTORY "${OUTPUT_DIR}")
+    include_directories("${OUTPUT_DIR}")
+    set(SOURCES "")
+    foreach (FONT ${ARGN})
+        get_filename_component(FONT_PATH "${FONT}" ABSOLUTE)
+        get_filename_component(FONT_NAME "${FONT}" NAME)
+        # C identifier named after the font file, like "DejaVuSans_ttf"
+        string(REGEX REPLACE "[^A-Za-z0-9_]" "_" SYMBOL "${FONT_NAME}")
+        if (SYMBOL MATCHES "^[0-9]")
+            set(SYMBOL "_${SYMBOL}")
+        endif ()
+        add_custom_command(
+            OUTPUT "${OUTPUT_DIR}/${SYMBOL}.cpp" "${OUTPUT_DIR}/${SYMBOL}.h"
+            COMMAND ${CMAKE_COMMAND} -DGLTEXT_EMBED_FONT=${FONT_PATH} -DGLTEXT_EMBED_SYMBOL=${SYMBOL}
+                    -DGLTEXT_EMBED_SOURCE=${OUTPUT_DIR}/${SYMBOL}.cpp -DGLTEXT_EMBED_HEADER=${OUTPUT_DIR}/${SYMBOL}.h
+                    -P "${GLTEXT_EMBED_FONTS_SCRIPT}"
+            DEPENDS "${FONT_PATH}" "${GLTEXT_EMBED_FONTS_SCRIPT}"
+            COMMENT "Embedding font ${FONT_NAME}"
+        )
+        list(APPEND SOURCES "${OUTPUT_DIR}/${SYMBOL}.cpp" "${OUTPUT_DIR}/${SYMBOL}.h")
+    endforeach ()
+    set(${SOURCES_VARIABLE} ${SOURCES} PARENT_SCOPE)
+endfunction()
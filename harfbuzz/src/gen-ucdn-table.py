@@ -0,0 +1,152 @@
+#!/usr/bin/python
+
+# Packs the UCDN properties used by the HarfBuzz unicode callbacks into a
+# single two-level table, so that hb-ucdn.cc answers each query with one
+# index lookup instead of walking the three-level UCDN index plus the
+# bsearch over the mirroring pairs.
+#
+# The input is UCDN's own generated database, so the packed table always
+# matches the ucdn_* functions it replaces.
+
+import sys
+import re
+
+if len (sys.argv) != 2:
+	sys.stderr.write ("usage: ./gen-ucdn-table.py hb-ucdn/unicodedata_db.h\n")
+	sys.exit (1)
+
+db = open (sys.argv[1]).read ()
+
+def array (name):
+	m = re.search (r'static const \w+(?: \w+)? %s\[\] = \{(.*?)\};' % name, db, re.S)
+	return m.group (1)
+
+def define (name):
+	return int (re.search (r'#define %s (\S+)' % name, db).group (1))
+
+version = re.search (r'#define UNIDATA_VERSION "([^"]*)"', db).group (1)
+
+records = [tuple (int (v) for v in r.split (','))
+	   for r in re.findall (r'\{([^{}]*)\}', array ('ucd_records'))]
+mirrors = dict (tuple (int (v) for v in r.split (','))
+		for r in re.findall (r'\{([^{}]*)\}', array ('mirror_pairs')))
+index0 = [int (v) for v in array ('index0').split (',') if v.strip ()]
+index1 = [int (v) for v in array ('index1').split (',') if v.strip ()]
+index2 = [int (v) for v in array ('index2').split (',') if v.strip ()]
+SHIFT1 = define ('SHIFT1')
+SHIFT2 = define ('SHIFT2')
+EAST_ASIAN_F = define ('UCDN_EAST_ASIAN_F')
+EAST_ASIAN_W = define ('UCDN_EAST_ASIAN_W')
+
+def ucd_record (u):
+	i = index0[u >> (SHIFT1 + SHIFT2)] << SHIFT1
+	i = index1[i + ((u >> SHIFT2) & ((1 << SHIFT1) - 1))] << SHIFT2
+	return records[index2[i + (u & ((1 << SHIFT2) - 1))]]
+
+# Mirroring is stored as a delta to the mirrored codepoint, through a small
+# table of the distinct deltas; delta 0 (index 0) means "not mirrored".
+deltas = [0]
+for u in sorted (mirrors):
+	if mirrors[u] - u not in deltas:
+		deltas.append (mirrors[u] - u)
+
+# Packed layout, low bits first:
+#   general category   5 bits
+#   combining class    8 bits
+#   script             8 bits
+#   east asian wide    1 bit
+#   mirroring delta    remaining bits
+GC_BITS, CCC_BITS, SCRIPT_BITS, WIDE_BITS = 5, 8, 8, 1
+DELTA_SHIFT = GC_BITS + CCC_BITS + SCRIPT_BITS + WIDE_BITS
+assert max (r[0] for r in records) < (1 << GC_BITS)
+assert max (r[6] for r in records) < (1 << SCRIPT_BITS)
+assert len (deltas) <= (1 << (32 - DELTA_SHIFT))
+
+def pack (u):
+	category, combining, bidi, mirrored, east_asian, normalization, script = ucd_record (u)
+	wide = 1 if east_asian in (EAST_ASIAN_F, EAST_ASIAN_W) else 0
+	delta = deltas.index (mirrors[u] - u) if mirrored and u in mirrors else 0
+	return (category |
+		(combining << GC_BITS) |
+		(script << (GC_BITS + CCC_BITS)) |
+		(wide << (GC_BITS + CCC_BITS + SCRIPT_BITS)) |
+		(delta << DELTA_SHIFT))
+
+values = [pack (u) for u in range (0x110000)]
+
+# What UCDN answers for codepoints past the end of Unicode.
+invalid = records[0]
+invalid = (invalid[0] |
+	   (invalid[1] << GC_BITS) |
+	   (invalid[6] << (GC_BITS + CCC_BITS)) |
+	   ((1 if invalid[4] in (EAST_ASIAN_F, EAST_ASIAN_W) else 0) << (GC_BITS + CCC_BITS + SCRIPT_BITS)))
+
+# Unique records, and a two-level index into them; pick the block size
+# giving the smallest total.
+packed = sorted (set (values))
+packed_index = dict ((v, i) for i, v in enumerate (packed))
+assert len (packed) <= 0x10000
+record_type, record_size = ('uint8_t', 1) if len (packed) <= 0x100 else ('uint16_t', 2)
+
+def split (shift):
+	blocks = []
+	block_index = {}
+	index = []
+	for start in range (0, 0x110000, 1 << shift):
+		block = tuple (packed_index[v] for v in values[start:start + (1 << shift)])
+		if block not in block_index:
+			block_index[block] = len (blocks)
+			blocks.append (block)
+		index.append (block_index[block])
+	return index, blocks
+
+best = None
+for shift in range (4, 10):
+	index, blocks = split (shift)
+	index_size = 1 if len (blocks) <= 0x100 else 2
+	size = len (index) * index_size + len (blocks) * (1 << shift) * record_size
+	if best is None or size < best[0]:
+		best = (size, shift, index, blocks, index_size)
+size, shift, index, blocks, index_size = best
+index_type = 'uint8_t' if index_size == 1 else 'uint16_t'
+
+def dump (type, name, items, per_line, fmt):
+	print ("static const %s %s[%d] =" % (type, name, len (items)))
+	print ("{")
+	for i in range (0, len (items), per_line):
+		print ("  " + ", ".join (fmt % v for v in items[i:i + per_line]) + ",")
+	print ("};")
+	print ("")
+
+print ("/* == Start of generated table == */")
+print ("/*")
+print (" * The following tables are generated by running:")
+print (" *")
+print (" *   ./gen-ucdn-table.py hb-ucdn/unicodedata_db.h")
+print (" *")
+print (" * on UCDN data for Unicode %s." % version)
+print (" */")
+print ("")
+print ("#ifndef HB_UCDN_TABLE_HH")
+print ("#define HB_UCDN_TABLE_HH")
+print ("")
+print ("")
+print ("#define HB_UCDN_GENERAL_CATEGORY(v)\t((v) & 0x%Xu)" % ((1 << GC_BITS) - 1))
+print ("#define HB_UCDN_COMBINING_CLASS(v)\t(((v) >> %d) & 0x%Xu)" % (GC_BITS, (1 << CCC_BITS) - 1))
+print ("#define HB_UCDN_SCRIPT(v)\t\t(((v) >> %d) & 0x%Xu)" % (GC_BITS + CCC_BITS, (1 << SCRIPT_BITS) - 1))
+print ("#define HB_UCDN_EASTASIAN_WIDE(v)\t(((v) >> %d) & 1u)" % (GC_BITS + CCC_BITS + SCRIPT_BITS))
+print ("#define HB_UCDN_MIRRORING_DELTA(v)\t(_hb_ucdn_mirroring_deltas[(v) >> %d])" % DELTA_SHIFT)
+print ("")
+print ("#define HB_UCDN_BLOCK_SHIFT %d" % shift)
+print ("#define HB_UCDN_INVALID_RECORD 0x%08Xu" % invalid)
+print ("")
+print ("/* %d bytes. */" % (size + 4 * len (packed) + 4 * len (deltas)))
+print ("")
+dump ("int32_t", "_hb_ucdn_mirroring_deltas", deltas, 8, "%d")
+dump ("uint32_t", "_hb_ucdn_packed_records", packed, 6, "0x%08Xu")
+dump (index_type, "_hb_ucdn_block_index", index, 16, "%d")
+dump (record_type, "_hb_ucdn_record_index", [v for b in blocks for v in b], 16, "%d")
+print ("")
+print ("#endif /* HB_UCDN_TABLE_HH */")
+print ("")
+print ("/* == End of generated table == */")
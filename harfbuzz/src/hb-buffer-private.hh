@@ -115,6 +115,9 @@ struct hb_buffer_t {
   HB_INTERNAL void add (hb_codepoint_t  codepoint,
 			unsigned int    cluster);
   HB_INTERNAL void add_info (const hb_glyph_info_t &glyph_info);
+  HB_INTERNAL void add_ascii (const uint8_t   *text,
+			      unsigned int     count,
+			      unsigned int     cluster);
 
   HB_INTERNAL void reverse_range (unsigned int start, unsigned int end);
   HB_INTERNAL void reverse (void);
@@ -228,6 +228,27 @@ hb_buffer_t::add (hb_codepoint_t  codepoint,
   len++;
 }
 
+/* Bulk version of add() for a run of ASCII characters, one cluster per byte. */
+void
+hb_buffer_t::add_ascii (const uint8_t   *text,
+			unsigned int     count,
+			unsigned int     cluster)
+{
+  if (unlikely (!ensure (len + count))) return;
+
+  hb_glyph_info_t *glyph = &info[len];
+
+  memset (glyph, 0, count * sizeof (*glyph));
+  for (unsigned int i = 0; i < count; i++)
+  {
+    glyph[i].codepoint = text[i];
+    glyph[i].mask = 1;
+    glyph[i].cluster = cluster + i;
+  }
+
+  len += count;
+}
+
 void
 hb_buffer_t::add_info (const hb_glyph_info_t &glyph_info)
 {
@@ -1329,6 +1350,15 @@ hb_buffer_add_utf (hb_buffer_t  *buffer,
   const T *end = next + item_length;
   while (next < end)
   {
+    /* Bulk add runs of ASCII characters (always empty but for UTF-8). */
+    unsigned int ascii_length = hb_utf_ascii_length (next, end);
+    if (ascii_length)
+    {
+      buffer->add_ascii ((const uint8_t *) next, ascii_length, next - (const T *) text);
+      next += ascii_length;
+      continue;
+    }
+
     hb_codepoint_t u;
     const T *old_next = next;
     next = hb_utf_next (next, end, &u);
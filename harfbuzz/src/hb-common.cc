@@ -194,11 +194,10 @@ lang_equal (hb_language_t  v1,
   return *p1 == canon_map[*p2];
 }
 
-#if 0
 static unsigned int
 lang_hash (const void *key)
 {
-  const unsigned char *p = key;
+  const unsigned char *p = (const unsigned char *) key;
   unsigned int h = 0;
   while (canon_map[*p])
     {
@@ -208,73 +207,104 @@ lang_hash (const void *key)
 
   return h;
 }
-#endif
-
 
-struct hb_language_item_t {
+static hb_language_t
+lang_canonicalize (const char *key)
+{
+  char *lang = strdup (key);
+  if (unlikely (!lang))
+    return NULL;
+  for (unsigned char *p = (unsigned char *) lang; *p; p++)
+    *p = canon_map[*p];
+  return (hb_language_t) lang;
+}
 
-  struct hb_language_item_t *next;
-  hb_language_t lang;
 
-  inline bool operator == (const char *s) const {
-    return lang_equal (lang, s);
-  }
-
-  inline hb_language_item_t & operator = (const char *s) {
-    lang = (hb_language_t) strdup (s);
-    for (unsigned char *p = (unsigned char *) lang; *p; p++)
-      *p = canon_map[*p];
+/* Thread-safe lock-free language table
+ *
+ * Languages are interned in open-addressed hash tables whose slots are set
+ * once and never change, so lookups take no lock.  A language goes to the
+ * first table of the chain where its probe sequence has a free slot, and
+ * when it has none, to the next table, twice as large, created on demand.
+ * As slots never get freed, two threads interning the same language always
+ * race for the same slot. */
 
-    return *this;
-  }
+#define HB_LANGUAGE_TABLE_INITIAL_SIZE 64
+#define HB_LANGUAGE_TABLE_MAX_PROBES 8
 
-  void finish (void) { free ((void *) lang); }
+struct hb_language_table_t {
+  struct hb_language_table_t *next;
+  unsigned int mask;
+  hb_language_t langs[1];
 };
 
-
-/* Thread-safe lock-free language list */
-
-static hb_language_item_t *langs;
+static hb_language_table_t *langs;
 
 static inline
 void free_langs (void)
 {
   while (langs) {
-    hb_language_item_t *next = langs->next;
-    langs->finish ();
+    hb_language_table_t *next = langs->next;
+    for (unsigned int i = 0; i <= langs->mask; i++)
+      free ((void *) langs->langs[i]);
     free (langs);
     langs = next;
   }
 }
 
-static hb_language_item_t *
+static hb_language_t
 lang_find_or_insert (const char *key)
 {
-retry:
-  hb_language_item_t *first_lang = (hb_language_item_t *) hb_atomic_ptr_get (&langs);
+  unsigned int hash = lang_hash (key);
+  hb_language_t lang = NULL; /* Canonical copy of key, made when inserting. */
+  hb_language_table_t **next = &langs;
 
-  for (hb_language_item_t *lang = first_lang; lang; lang = lang->next)
-    if (*lang == key)
-      return lang;
+  for (unsigned int size = HB_LANGUAGE_TABLE_INITIAL_SIZE; ; size *= 2)
+  {
+    hb_language_table_t *table = (hb_language_table_t *) hb_atomic_ptr_get (next);
+    if (!table)
+    {
+      table = (hb_language_table_t *) calloc (1, sizeof (hb_language_table_t) + (size - 1) * sizeof (hb_language_t));
+      if (unlikely (!table))
+        break;
+      table->mask = size - 1;
+
+      if (!hb_atomic_ptr_cmpexch (next, NULL, table)) {
+	/* Someone else was faster. */
+	free (table);
+	table = (hb_language_table_t *) hb_atomic_ptr_get (next);
+      }
+#ifdef HAVE_ATEXIT
+      else if (next == &langs)
+	atexit (free_langs); /* First person registers atexit() callback. */
+#endif
+    }
 
-  /* Not found; allocate one. */
-  hb_language_item_t *lang = (hb_language_item_t *) calloc (1, sizeof (hb_language_item_t));
-  if (unlikely (!lang))
-    return NULL;
-  lang->next = first_lang;
-  *lang = key;
+    for (unsigned int i = 0; i < HB_LANGUAGE_TABLE_MAX_PROBES; i++)
+    {
+      hb_language_t *slot = &table->langs[(hash + i) & table->mask];
+      hb_language_t item = (hb_language_t) hb_atomic_ptr_get (slot);
+      if (!item)
+      {
+	/* Not found; insert it. */
+	if (!lang && unlikely (!(lang = lang_canonicalize (key))))
+	  return NULL;
+	if (hb_atomic_ptr_cmpexch (slot, NULL, lang))
+	  return lang;
+	/* Someone else was faster; see what they inserted. */
+	item = (hb_language_t) hb_atomic_ptr_get (slot);
+      }
+      if (lang_equal (item, key)) {
+	free ((void *) lang);
+	return item;
+      }
+    }
 
-  if (!hb_atomic_ptr_cmpexch (&langs, first_lang, lang)) {
-    free (lang);
-    goto retry;
+    next = &table->next;
   }
 
-#ifdef HAVE_ATEXIT
-  if (!first_lang)
-    atexit (free_langs); /* First person registers atexit() callback. */
-#endif
-
-  return lang;
+  free ((void *) lang);
+  return NULL;
 }
 
 
@@ -304,9 +334,7 @@ hb_language_from_string (const char *str, int len)
     strbuf[len] = '\0';
   }
 
-  hb_language_item_t *item = lang_find_or_insert (str);
-
-  return likely (item) ? item->lang : HB_LANGUAGE_INVALID;
+  return lang_find_or_insert (str);
 }
 
 /**
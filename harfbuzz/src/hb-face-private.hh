@@ -41,6 +41,8 @@
  * hb_face_t
  */
 
+#define HB_FACE_SHAPE_PLANS_BUCKETS 32 /* Must be a power of two. */
+
 struct hb_face_t {
   hb_object_header_t header;
   ASSERT_POD ();
@@ -57,10 +59,12 @@ struct hb_face_t {
 
   struct hb_shaper_data_t shaper_data;
 
+  /* Cached shape plans, hashed on segment properties and user features. */
   struct plan_node_t {
     hb_shape_plan_t *shape_plan;
+    unsigned int hash;
     plan_node_t *next;
-  } *shape_plans;
+  } *shape_plans[HB_FACE_SHAPE_PLANS_BUCKETS];
 
 
   inline hb_blob_t *reference_table (hb_tag_t tag) const
@@ -64,7 +64,7 @@ const hb_face_t _hb_face_nil = {
 #undef HB_SHAPER_IMPLEMENT
   },
 
-  NULL, /* shape_plans */
+  {NULL}, /* shape_plans */
 };
 
 
@@ -228,13 +228,14 @@ hb_face_destroy (hb_face_t *face)
 {
   if (!hb_object_destroy (face)) return;
 
-  for (hb_face_t::plan_node_t *node = face->shape_plans; node; )
-  {
-    hb_face_t::plan_node_t *next = node->next;
-    hb_shape_plan_destroy (node->shape_plan);
-    free (node);
-    node = next;
-  }
+  for (unsigned int i = 0; i < ARRAY_LENGTH (face->shape_plans); i++)
+    for (hb_face_t::plan_node_t *node = face->shape_plans[i]; node; )
+    {
+      hb_face_t::plan_node_t *next = node->next;
+      hb_shape_plan_destroy (node->shape_plan);
+      free (node);
+      node = next;
+    }
 
 #define HB_SHAPER_IMPLEMENT(shaper) HB_SHAPER_DATA_DESTROY(shaper, face);
 #include "hb-shaper-list.hh"
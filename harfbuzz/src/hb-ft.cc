@@ -55,12 +55,241 @@
  *
  *   - In the future, we should add constructors to create fonts in font space?
  *
- *   - FT_Load_Glyph() is exteremely costly.  Do something about it?
+ *   - FT_Load_Glyph() is exteremely costly.  Glyph advances, extents and
+ *     contour points are thus cached per font (that is, per size), see
+ *     hb_ft_font_t below.
  */
 
 
+/*
+ * hb_ft_font_t
+ *
+ * Font data attached to the hb_font_t: the FT_Face, plus tables caching the
+ * per-glyph results of the costly FreeType calls.  Tables are allocated on
+ * first use, and each entry is filled the first time its glyph is queried.
+ * As the FT_Face it wraps, it must not be used from multiple threads at once,
+ * and the size of the FT_Face must not be changed once the font is created.
+ */
+
+#define HB_FT_ADVANCE_INVALID ((hb_position_t) 0x80000000)
+
+/* FreeType has no API to enumerate the kerning pairs of a face, so instead
+ * of a full table, pairs are cached as they are queried, in a direct-mapped
+ * cache keyed by both glyphs. */
+#define HB_FT_KERNING_CACHE_BITS 10
+#define HB_FT_KERNING_PAIR_INVALID 0xFFFFFFFFu
+
+struct hb_ft_kerning_cache_t
+{
+  FT_Kerning_Mode mode;
+  uint32_t pairs[1u << HB_FT_KERNING_CACHE_BITS];	/* HB_FT_KERNING_PAIR_INVALID if empty. */
+  hb_position_t kernings[1u << HB_FT_KERNING_CACHE_BITS];
+};
+
+struct hb_ft_contour_points_t
+{
+  unsigned int num_points;
+  FT_Vector points[1];		/* Actually num_points long. */
+};
+
+/*
+ * hb_ft_cmap_t
+ *
+ * Copy of the Unicode cmap of a face: a dense array for the BMP, so that
+ * mapping a codepoint costs one array read, plus a sorted array for the
+ * supplementary planes.  It is built the first time a font needs it, and
+ * then shared by all fonts of the same hb_face_t (as face user data).
+ */
+
+struct hb_ft_cmap_pair_t
+{
+  hb_codepoint_t unicode;
+  hb_codepoint_t glyph;
+
+  static int cmp (const hb_codepoint_t *unicode, const hb_ft_cmap_pair_t *pair)
+  {
+    return *unicode < pair->unicode ? -1 : *unicode > pair->unicode ? +1 : 0;
+  }
+};
+
+struct hb_ft_cmap_t
+{
+  uint16_t bmp[0x10000];		/* 0 if not mapped. */
+  hb_prealloced_array_t<hb_ft_cmap_pair_t, 16> supplementary;
+
+  inline hb_codepoint_t get_glyph (hb_codepoint_t unicode) const
+  {
+    if (likely (unicode < ARRAY_LENGTH (bmp)))
+      return bmp[unicode];
+
+    const hb_ft_cmap_pair_t *pair = supplementary.bsearch (&unicode);
+    return pair ? pair->glyph : 0;
+  }
+};
+
+static void
+_hb_ft_cmap_destroy (hb_ft_cmap_t *cmap)
+{
+  cmap->supplementary.finish ();
+  free (cmap);
+}
+
+static hb_ft_cmap_t *
+_hb_ft_cmap_create (FT_Face ft_face)
+{
+  /* Glyph ids are stored on 16 bits, as in the cmap table itself. */
+  if (unlikely (ft_face->num_glyphs > 0x10000))
+    return NULL;
+
+  hb_ft_cmap_t *cmap = (hb_ft_cmap_t *) calloc (1, sizeof (hb_ft_cmap_t));
+  if (unlikely (!cmap))
+    return NULL;
+
+  /* FT_Get_Next_Char() walks the charmap in increasing codepoint order,
+   * so the supplementary array gets sorted for free. */
+  FT_UInt glyph;
+  FT_ULong unicode = FT_Get_First_Char (ft_face, &glyph);
+  while (glyph)
+  {
+    if (unicode < ARRAY_LENGTH (cmap->bmp))
+      cmap->bmp[unicode] = glyph;
+    else
+    {
+      hb_ft_cmap_pair_t *pair = cmap->supplementary.push ();
+      if (unlikely (!pair))
+      {
+	_hb_ft_cmap_destroy (cmap);
+	return NULL;
+      }
+      pair->unicode = unicode;
+      pair->glyph = glyph;
+    }
+    unicode = FT_Get_Next_Char (ft_face, unicode, &glyph);
+  }
+
+  return cmap;
+}
+
+static hb_user_data_key_t _hb_ft_cmap_user_data_key;
+
+static const hb_ft_cmap_t *
+_hb_ft_cmap_get (hb_face_t *face, FT_Face ft_face)
+{
+  hb_ft_cmap_t *cmap = (hb_ft_cmap_t *) hb_face_get_user_data (face, &_hb_ft_cmap_user_data_key);
+
+  if (unlikely (!cmap))
+  {
+    cmap = _hb_ft_cmap_create (ft_face);
+    if (unlikely (!cmap))
+      return NULL;
+
+    if (!hb_face_set_user_data (face, &_hb_ft_cmap_user_data_key,
+				cmap, (hb_destroy_func_t) _hb_ft_cmap_destroy,
+				false)) {
+      /* Someone else was faster, or the face is inert, or out of memory:
+       * use the cmap published meanwhile if any, else let the caller fall back
+       * to uncached lookups. */
+      _hb_ft_cmap_destroy (cmap);
+      cmap = (hb_ft_cmap_t *) hb_face_get_user_data (face, &_hb_ft_cmap_user_data_key);
+    }
+  }
+
+  return cmap;
+}
+
+
+struct hb_ft_font_t
+{
+  FT_Face ft_face;
+  hb_bool_t owns_ft_face;
+  unsigned int num_glyphs;
+
+  const hb_ft_cmap_t *cmap;		/* Owned by the face; NULL if not built yet. */
+  hb_bool_t cmap_failed;
+
+  hb_position_t *h_advances;		/* HB_FT_ADVANCE_INVALID if not loaded yet. */
+  hb_position_t *v_advances;		/* HB_FT_ADVANCE_INVALID if not loaded yet. */
+  hb_glyph_extents_t *extents;
+  uint32_t *extents_loaded;		/* One bit per glyph. */
+  hb_ft_contour_points_t **contour_points;	/* NULL if not loaded yet. */
+  hb_ft_kerning_cache_t *kerning_cache;
+};
+
+static hb_ft_contour_points_t _hb_ft_no_contour_points = {0, {{0, 0}}};
+
+static hb_ft_font_t *
+_hb_ft_font_create (FT_Face ft_face, hb_bool_t owns_ft_face)
+{
+  hb_ft_font_t *ft_font = (hb_ft_font_t *) calloc (1, sizeof (hb_ft_font_t));
+  if (unlikely (!ft_font))
+    return NULL;
+
+  ft_font->ft_face = ft_face;
+  ft_font->owns_ft_face = owns_ft_face;
+  ft_font->num_glyphs = ft_face->num_glyphs > 0 ? ft_face->num_glyphs : 0;
+
+  return ft_font;
+}
+
+static void
+_hb_ft_font_destroy (hb_ft_font_t *ft_font)
+{
+  if (ft_font->contour_points)
+  {
+    for (unsigned int i = 0; i < ft_font->num_glyphs; i++)
+      if (ft_font->contour_points[i] != &_hb_ft_no_contour_points)
+	free (ft_font->contour_points[i]);
+    free (ft_font->contour_points);
+  }
+  free (ft_font->kerning_cache);
+  free (ft_font->extents_loaded);
+  free (ft_font->extents);
+  free (ft_font->v_advances);
+  free (ft_font->h_advances);
+
+  if (ft_font->owns_ft_face)
+    FT_Done_Face (ft_font->ft_face);
+
+  free (ft_font);
+}
+
+static hb_position_t *
+_hb_ft_font_create_advances (unsigned int num_glyphs)
+{
+  hb_position_t *advances = (hb_position_t *) malloc (num_glyphs * sizeof (hb_position_t));
+  if (likely (advances))
+    for (unsigned int i = 0; i < num_glyphs; i++)
+      advances[i] = HB_FT_ADVANCE_INVALID;
+  return advances;
+}
+
+static hb_position_t
+_hb_ft_get_advance (FT_Face ft_face, hb_codepoint_t glyph, int load_flags)
+{
+  FT_Fixed v;
+
+  if (unlikely (FT_Get_Advance (ft_face, glyph, load_flags, &v)))
+    return 0;
+
+  return (v + (1<<9)) >> 10;
+}
+
+static hb_position_t
+_hb_ft_get_v_advance (FT_Face ft_face, hb_codepoint_t glyph, int load_flags)
+{
+  FT_Fixed v;
+
+  if (unlikely (FT_Get_Advance (ft_face, glyph, load_flags, &v)))
+    return 0;
+
+  /* Note: FreeType's vertical metrics grows downward while other FreeType coordinates
+   * have a Y growing upward.  Hence the extra negation, done before rounding. */
+  return (-v + (1<<9)) >> 10;
+}
+
+
 static hb_bool_t
-hb_ft_get_glyph (hb_font_t *font HB_UNUSED,
+hb_ft_get_glyph (hb_font_t *font,
 		 void *font_data,
 		 hb_codepoint_t unicode,
 		 hb_codepoint_t variation_selector,
@@ -68,7 +297,8 @@ hb_ft_get_glyph (hb_font_t *font HB_UNUSED,
 		 void *user_data HB_UNUSED)
 
 {
-  FT_Face ft_face = (FT_Face) font_data;
+  hb_ft_font_t *ft_font = (hb_ft_font_t *) font_data;
+  FT_Face ft_face = ft_font->ft_face;
 
 #ifdef HAVE_FT_FACE_GETCHARVARIANTINDEX
   if (unlikely (variation_selector)) {
@@ -77,7 +307,19 @@ hb_ft_get_glyph (hb_font_t *font HB_UNUSED,
   }
 #endif
 
-  *glyph = FT_Get_Char_Index (ft_face, unicode);
+  if (unlikely (!ft_font->cmap))
+  {
+    if (!ft_font->cmap_failed)
+      ft_font->cmap = _hb_ft_cmap_get (font->face, ft_face);
+    if (unlikely (!ft_font->cmap))
+    {
+      ft_font->cmap_failed = true;
+      *glyph = FT_Get_Char_Index (ft_face, unicode);
+      return *glyph != 0;
+    }
+  }
+
+  *glyph = ft_font->cmap->get_glyph (unicode);
   return *glyph != 0;
 }
 
@@ -87,14 +329,24 @@ hb_ft_get_glyph_h_advance (hb_font_t *font HB_UNUSED,
 			   hb_codepoint_t glyph,
 			   void *user_data HB_UNUSED)
 {
-  FT_Face ft_face = (FT_Face) font_data;
+  hb_ft_font_t *ft_font = (hb_ft_font_t *) font_data;
   int load_flags = FT_LOAD_DEFAULT | FT_LOAD_NO_HINTING;
-  FT_Fixed v;
 
-  if (unlikely (FT_Get_Advance (ft_face, glyph, load_flags, &v)))
-    return 0;
+  if (unlikely (glyph >= ft_font->num_glyphs))
+    return _hb_ft_get_advance (ft_font->ft_face, glyph, load_flags);
 
-  return (v + (1<<9)) >> 10;
+  if (unlikely (!ft_font->h_advances))
+  {
+    ft_font->h_advances = _hb_ft_font_create_advances (ft_font->num_glyphs);
+    if (unlikely (!ft_font->h_advances))
+      return _hb_ft_get_advance (ft_font->ft_face, glyph, load_flags);
+  }
+
+  hb_position_t *advance = &ft_font->h_advances[glyph];
+  if (unlikely (*advance == HB_FT_ADVANCE_INVALID))
+    *advance = _hb_ft_get_advance (ft_font->ft_face, glyph, load_flags);
+
+  return *advance;
 }
 
 static hb_position_t
@@ -103,16 +355,24 @@ hb_ft_get_glyph_v_advance (hb_font_t *font HB_UNUSED,
 			   hb_codepoint_t glyph,
 			   void *user_data HB_UNUSED)
 {
-  FT_Face ft_face = (FT_Face) font_data;
+  hb_ft_font_t *ft_font = (hb_ft_font_t *) font_data;
   int load_flags = FT_LOAD_DEFAULT | FT_LOAD_NO_HINTING | FT_LOAD_VERTICAL_LAYOUT;
-  FT_Fixed v;
 
-  if (unlikely (FT_Get_Advance (ft_face, glyph, load_flags, &v)))
-    return 0;
+  if (unlikely (glyph >= ft_font->num_glyphs))
+    return _hb_ft_get_v_advance (ft_font->ft_face, glyph, load_flags);
 
-  /* Note: FreeType's vertical metrics grows downward while other FreeType coordinates
-   * have a Y growing upward.  Hence the extra negation. */
-  return (-v + (1<<9)) >> 10;
+  if (unlikely (!ft_font->v_advances))
+  {
+    ft_font->v_advances = _hb_ft_font_create_advances (ft_font->num_glyphs);
+    if (unlikely (!ft_font->v_advances))
+      return _hb_ft_get_v_advance (ft_font->ft_face, glyph, load_flags);
+  }
+
+  hb_position_t *advance = &ft_font->v_advances[glyph];
+  if (unlikely (*advance == HB_FT_ADVANCE_INVALID))
+    *advance = _hb_ft_get_v_advance (ft_font->ft_face, glyph, load_flags);
+
+  return *advance;
 }
 
 static hb_bool_t
@@ -135,7 +395,7 @@ hb_ft_get_glyph_v_origin (hb_font_t *font HB_UNUSED,
 			  hb_position_t *y,
 			  void *user_data HB_UNUSED)
 {
-  FT_Face ft_face = (FT_Face) font_data;
+  FT_Face ft_face = ((const hb_ft_font_t *) font_data)->ft_face;
   int load_flags = FT_LOAD_DEFAULT;
 
   if (unlikely (FT_Load_Glyph (ft_face, glyph, load_flags)))
@@ -156,14 +416,37 @@ hb_ft_get_glyph_h_kerning (hb_font_t *font,
 			   hb_codepoint_t right_glyph,
 			   void *user_data HB_UNUSED)
 {
-  FT_Face ft_face = (FT_Face) font_data;
+  hb_ft_font_t *ft_font = (hb_ft_font_t *) font_data;
+  FT_Face ft_face = ft_font->ft_face;
   FT_Vector kerningv;
 
-  FT_Kerning_Mode mode = font->x_ppem ? FT_KERNING_DEFAULT : FT_KERNING_UNFITTED;
-  if (FT_Get_Kerning (ft_face, left_glyph, right_glyph, mode, &kerningv))
+  if (!FT_HAS_KERNING (ft_face))
     return 0;
 
-  return kerningv.x;
+  FT_Kerning_Mode mode = font->x_ppem ? FT_KERNING_DEFAULT : FT_KERNING_UNFITTED;
+  uint32_t pair = (left_glyph << 16) | right_glyph;
+  if (unlikely ((left_glyph | right_glyph) > 0xFFFFu || pair == HB_FT_KERNING_PAIR_INVALID))
+    return FT_Get_Kerning (ft_face, left_glyph, right_glyph, mode, &kerningv) ? 0 : kerningv.x;
+
+  hb_ft_kerning_cache_t *cache = ft_font->kerning_cache;
+  if (unlikely (!cache || cache->mode != mode))
+  {
+    if (!cache)
+      cache = ft_font->kerning_cache = (hb_ft_kerning_cache_t *) malloc (sizeof (hb_ft_kerning_cache_t));
+    if (unlikely (!cache))
+      return FT_Get_Kerning (ft_face, left_glyph, right_glyph, mode, &kerningv) ? 0 : kerningv.x;
+    cache->mode = mode;
+    memset (cache->pairs, 0xFF, sizeof (cache->pairs));
+  }
+
+  unsigned int i = (pair * 2654435761u) >> (32 - HB_FT_KERNING_CACHE_BITS);
+  if (cache->pairs[i] != pair)
+  {
+    cache->pairs[i] = pair;
+    cache->kernings[i] = FT_Get_Kerning (ft_face, left_glyph, right_glyph, mode, &kerningv) ? 0 : kerningv.x;
+  }
+
+  return cache->kernings[i];
 }
 
 static hb_position_t
@@ -178,13 +461,10 @@ hb_ft_get_glyph_v_kerning (hb_font_t *font HB_UNUSED,
 }
 
 static hb_bool_t
-hb_ft_get_glyph_extents (hb_font_t *font HB_UNUSED,
-			 void *font_data,
-			 hb_codepoint_t glyph,
-			 hb_glyph_extents_t *extents,
-			 void *user_data HB_UNUSED)
+_hb_ft_load_glyph_extents (FT_Face ft_face,
+			   hb_codepoint_t glyph,
+			   hb_glyph_extents_t *extents)
 {
-  FT_Face ft_face = (FT_Face) font_data;
   int load_flags = FT_LOAD_DEFAULT;
 
   if (unlikely (FT_Load_Glyph (ft_face, glyph, load_flags)))
@@ -197,6 +477,70 @@ hb_ft_get_glyph_extents (hb_font_t *font HB_UNUSED,
   return true;
 }
 
+static hb_bool_t
+hb_ft_get_glyph_extents (hb_font_t *font HB_UNUSED,
+			 void *font_data,
+			 hb_codepoint_t glyph,
+			 hb_glyph_extents_t *extents,
+			 void *user_data HB_UNUSED)
+{
+  hb_ft_font_t *ft_font = (hb_ft_font_t *) font_data;
+
+  if (unlikely (glyph >= ft_font->num_glyphs))
+    return _hb_ft_load_glyph_extents (ft_font->ft_face, glyph, extents);
+
+  if (unlikely (!ft_font->extents))
+  {
+    ft_font->extents = (hb_glyph_extents_t *) malloc (ft_font->num_glyphs * sizeof (hb_glyph_extents_t));
+    ft_font->extents_loaded = (uint32_t *) calloc ((ft_font->num_glyphs + 31) / 32, sizeof (uint32_t));
+    if (unlikely (!ft_font->extents || !ft_font->extents_loaded))
+    {
+      free (ft_font->extents_loaded);
+      free (ft_font->extents);
+      ft_font->extents_loaded = NULL;
+      ft_font->extents = NULL;
+      return _hb_ft_load_glyph_extents (ft_font->ft_face, glyph, extents);
+    }
+  }
+
+  uint32_t *loaded = &ft_font->extents_loaded[glyph / 32];
+  uint32_t mask = 1u << (glyph % 32);
+  if (unlikely (!(*loaded & mask)))
+  {
+    /* Glyphs that fail to load are not cached, to report the failure each time. */
+    if (unlikely (!_hb_ft_load_glyph_extents (ft_font->ft_face, glyph, &ft_font->extents[glyph])))
+      return false;
+    *loaded |= mask;
+  }
+
+  *extents = ft_font->extents[glyph];
+  return true;
+}
+
+static hb_ft_contour_points_t *
+_hb_ft_load_contour_points (FT_Face ft_face,
+			    hb_codepoint_t glyph)
+{
+  int load_flags = FT_LOAD_DEFAULT;
+
+  if (unlikely (FT_Load_Glyph (ft_face, glyph, load_flags)))
+      return &_hb_ft_no_contour_points;
+
+  if (unlikely (ft_face->glyph->format != FT_GLYPH_FORMAT_OUTLINE))
+      return &_hb_ft_no_contour_points;
+
+  unsigned int num_points = ft_face->glyph->outline.n_points > 0 ? ft_face->glyph->outline.n_points : 0;
+  hb_ft_contour_points_t *contour_points = (hb_ft_contour_points_t *)
+    malloc (sizeof (hb_ft_contour_points_t) + num_points * sizeof (FT_Vector));
+  if (unlikely (!contour_points))
+    return NULL;
+
+  contour_points->num_points = num_points;
+  memcpy (contour_points->points, ft_face->glyph->outline.points, num_points * sizeof (FT_Vector));
+
+  return contour_points;
+}
+
 static hb_bool_t
 hb_ft_get_glyph_contour_point (hb_font_t *font HB_UNUSED,
 			       void *font_data,
@@ -206,20 +550,32 @@ hb_ft_get_glyph_contour_point (hb_font_t *font HB_UNUSED,
 			       hb_position_t *y,
 			       void *user_data HB_UNUSED)
 {
-  FT_Face ft_face = (FT_Face) font_data;
-  int load_flags = FT_LOAD_DEFAULT;
+  hb_ft_font_t *ft_font = (hb_ft_font_t *) font_data;
 
-  if (unlikely (FT_Load_Glyph (ft_face, glyph, load_flags)))
+  if (unlikely (glyph >= ft_font->num_glyphs))
       return false;
 
-  if (unlikely (ft_face->glyph->format != FT_GLYPH_FORMAT_OUTLINE))
+  if (unlikely (!ft_font->contour_points))
+  {
+    ft_font->contour_points = (hb_ft_contour_points_t **) calloc (ft_font->num_glyphs, sizeof (hb_ft_contour_points_t *));
+    if (unlikely (!ft_font->contour_points))
+      return false;
+  }
+
+  hb_ft_contour_points_t *contour_points = ft_font->contour_points[glyph];
+  if (unlikely (!contour_points))
+  {
+    contour_points = _hb_ft_load_contour_points (ft_font->ft_face, glyph);
+    if (unlikely (!contour_points))
       return false;
+    ft_font->contour_points[glyph] = contour_points;
+  }
 
-  if (unlikely (point_index >= (unsigned int) ft_face->glyph->outline.n_points))
+  if (unlikely (point_index >= contour_points->num_points))
       return false;
 
-  *x = ft_face->glyph->outline.points[point_index].x;
-  *y = ft_face->glyph->outline.points[point_index].y;
+  *x = contour_points->points[point_index].x;
+  *y = contour_points->points[point_index].y;
 
   return true;
 }
@@ -231,7 +587,7 @@ hb_ft_get_glyph_name (hb_font_t *font HB_UNUSED,
 		      char *name, unsigned int size,
 		      void *user_data HB_UNUSED)
 {
-  FT_Face ft_face = (FT_Face) font_data;
+  FT_Face ft_face = ((const hb_ft_font_t *) font_data)->ft_face;
 
   hb_bool_t ret = !FT_Get_Glyph_Name (ft_face, glyph, name, size);
   if (ret && (size && !*name))
@@ -247,7 +603,7 @@ hb_ft_get_glyph_from_name (hb_font_t *font HB_UNUSED,
 			   hb_codepoint_t *glyph,
 			   void *user_data HB_UNUSED)
 {
-  FT_Face ft_face = (FT_Face) font_data;
+  FT_Face ft_face = ((const hb_ft_font_t *) font_data)->ft_face;
 
   if (len < 0)
     *glyph = FT_Get_Name_Index (ft_face, (FT_String *) name);
@@ -388,12 +744,6 @@ hb_ft_face_create_cached (FT_Face ft_face)
   return hb_face_reference ((hb_face_t *) ft_face->generic.data);
 }
 
-static void
-_do_nothing (void)
-{
-}
-
-
 /**
  * hb_ft_font_create:
  * @ft_face: (destroy destroy) (scope notified): 
@@ -410,13 +760,17 @@ hb_ft_font_create (FT_Face           ft_face,
 {
   hb_font_t *font;
   hb_face_t *face;
+  hb_ft_font_t *ft_font;
 
   face = hb_ft_face_create (ft_face, destroy);
   font = hb_font_create (face);
   hb_face_destroy (face);
+  ft_font = _hb_ft_font_create (ft_face, false);
+  if (unlikely (!ft_font))
+    return font;
   hb_font_set_funcs (font,
 		     _hb_ft_get_font_funcs (),
-		     ft_face, (hb_destroy_func_t) _do_nothing);
+		     ft_font, (hb_destroy_func_t) _hb_ft_font_destroy);
   hb_font_set_scale (font,
 		     (int) (((uint64_t) ft_face->size->metrics.x_scale * (uint64_t) ft_face->units_per_EM + (1<<15)) >> 16),
 		     (int) (((uint64_t) ft_face->size->metrics.y_scale * (uint64_t) ft_face->units_per_EM + (1<<15)) >> 16));
@@ -505,18 +859,40 @@ hb_ft_font_set_funcs (hb_font_t *font)
   ft_face->generic.data = blob;
   ft_face->generic.finalizer = (FT_Generic_Finalizer) _release_blob;
 
+  hb_ft_font_t *ft_font = _hb_ft_font_create (ft_face, true);
+  if (unlikely (!ft_font)) {
+    FT_Done_Face (ft_face);
+    DEBUG_MSG (FT, font, "Font data allocation failed");
+    return;
+  }
+
+  hb_font_set_funcs (font,
+		     _hb_ft_get_font_funcs (),
+		     ft_font,
+		     (hb_destroy_func_t) _hb_ft_font_destroy);
+}
+
+void
+hb_ft_font_set_funcs_for_face (hb_font_t *font,
+			       FT_Face    ft_face)
+{
+  hb_ft_font_t *ft_font = _hb_ft_font_create (ft_face, false);
+  if (unlikely (!ft_font)) {
+    DEBUG_MSG (FT, font, "Font data allocation failed");
+    return;
+  }
+
   hb_font_set_funcs (font,
 		     _hb_ft_get_font_funcs (),
-		     ft_face,
-		     (hb_destroy_func_t) FT_Done_Face);
+		     ft_font,
+		     (hb_destroy_func_t) _hb_ft_font_destroy);
 }
 
 FT_Face
 hb_ft_font_get_face (hb_font_t *font)
 {
-  if (font->destroy == (hb_destroy_func_t) FT_Done_Face ||
-      font->destroy == (hb_destroy_func_t) _do_nothing)
-    return (FT_Face) font->user_data;
+  if (font->destroy == (hb_destroy_func_t) _hb_ft_font_destroy)
+    return ((hb_ft_font_t *) font->user_data)->ft_face;
 
   return NULL;
 }
@@ -53,6 +53,12 @@ hb_ft_font_create (FT_Face           ft_face,
 void
 hb_ft_font_set_funcs (hb_font_t *font);
 
+/* Same, but with a FreeType face opened by the caller on the same font data as the face
+ * of the font.  The FT_Face is not owned: it must outlive the font. */
+void
+hb_ft_font_set_funcs_for_face (hb_font_t *font,
+			       FT_Face    ft_face);
+
 FT_Face
 hb_ft_font_get_face (hb_font_t *font);
 
@@ -955,6 +955,15 @@ struct ClassDefFormat1
         glyphs->add (startGlyph + i);
   }
 
+  inline bool flatten (uint16_t *classes, unsigned int num_glyphs) const {
+    unsigned int count = classValue.len;
+    if (count && unlikely (startGlyph + count > num_glyphs))
+      return false;
+    for (unsigned int i = 0; i < count; i++)
+      classes[startGlyph + i] = classValue[i];
+    return true;
+  }
+
   inline bool intersects_class (const hb_set_t *glyphs, unsigned int klass) const {
     unsigned int count = classValue.len;
     if (klass == 0)
@@ -1011,6 +1020,21 @@ struct ClassDefFormat2
         rangeRecord[i].add_coverage (glyphs);
   }
 
+  inline bool flatten (uint16_t *classes, unsigned int num_glyphs) const {
+    /* Only sorted, non-overlapping ranges flatten to what get_class() finds. */
+    unsigned int count = rangeRecord.len;
+    for (unsigned int i = 0; i < count; i++)
+    {
+      const RangeRecord &range = rangeRecord[i];
+      if (unlikely (range.start > range.end || range.end >= num_glyphs ||
+		    (i && range.start <= rangeRecord[i - 1].end)))
+	return false;
+      for (unsigned int g = range.start; g <= range.end; g++)
+	classes[g] = range.value;
+    }
+    return true;
+  }
+
   inline bool intersects_class (const hb_set_t *glyphs, unsigned int klass) const {
     unsigned int count = rangeRecord.len;
     if (klass == 0)
@@ -1081,6 +1105,16 @@ struct ClassDef
     }
   }
 
+  /* Fills classes, num_glyphs long and zeroed, with the class of each glyph.
+   * Returns false if the table doesn't flatten to the same answers. */
+  inline bool flatten (uint16_t *classes, unsigned int num_glyphs) const {
+    switch (u.format) {
+    case 1: return u.format1.flatten (classes, num_glyphs);
+    case 2: return u.format2.flatten (classes, num_glyphs);
+    default:return true;
+    }
+  }
+
   protected:
   union {
   USHORT		format;		/* Format identifier */
@@ -1091,6 +1125,32 @@ struct ClassDef
   DEFINE_SIZE_UNION (2, format);
 };
 
+/* A ClassDef flattened into an array indexed by glyph id, or just the
+ * ClassDef itself if it wasn't flattened. */
+struct ClassDefMap
+{
+  inline void init (const ClassDef &class_def_)
+  {
+    class_def = &class_def_;
+    num_glyphs = 0;
+    classes = NULL;
+  }
+
+  inline unsigned int get_class (hb_codepoint_t glyph_id) const
+  {
+    if (classes)
+      return likely (glyph_id < num_glyphs) ? classes[glyph_id] : 0;
+    return class_def->get_class (glyph_id);
+  }
+
+  static inline unsigned int hash (const ClassDef *class_def)
+  { return (unsigned int) ((uintptr_t) class_def >> 1) * 2654435761u; }
+
+  const ClassDef *class_def;
+  unsigned int num_glyphs;
+  uint16_t *classes;
+};
+
 
 /*
  * Device Tables
@@ -430,4 +430,37 @@ struct GDEF
 } /* namespace OT */
 
 
+inline unsigned int
+hb_ot_layout_t::get_glyph_props (hb_codepoint_t glyph) const
+{
+  if (glyph_props && likely (glyph < num_glyphs))
+    return glyph_props[glyph];
+  return gdef->get_glyph_props (glyph);
+}
+
+inline OT::ClassDefMap
+hb_ot_layout_lookup_accelerator_t::get_class_map (const OT::ClassDef &class_def) const
+{
+  if (class_maps)
+    for (unsigned int i = OT::ClassDefMap::hash (&class_def) & class_maps_mask;
+	 class_maps[i].class_def;
+	 i = (i + 1) & class_maps_mask)
+      if (class_maps[i].class_def == &class_def)
+	return class_maps[i];
+
+  OT::ClassDefMap map;
+  map.init (class_def);
+  return map;
+}
+
+inline void
+hb_ot_layout_lookup_accelerator_t::fini_class_maps (void)
+{
+  if (class_maps)
+    for (unsigned int i = 0; i <= class_maps_mask; i++)
+      free (class_maps[i].classes);
+  free (class_maps);
+}
+
+
 #endif /* HB_OT_LAYOUT_GDEF_TABLE_HH */
@@ -441,7 +441,7 @@ struct SinglePosFormat1
   {
     TRACE_APPLY (this);
     hb_buffer_t *buffer = c->buffer;
-    unsigned int index = (this+coverage).get_coverage  (buffer->cur().codepoint);
+    unsigned int index = c->get_coverage (this+coverage, buffer->cur().codepoint);
     if (likely (index == NOT_COVERED)) return TRACE_RETURN (false);
 
     valueFormat.apply_value (c->font, c->direction, this,
@@ -487,7 +487,7 @@ struct SinglePosFormat2
   {
     TRACE_APPLY (this);
     hb_buffer_t *buffer = c->buffer;
-    unsigned int index = (this+coverage).get_coverage  (buffer->cur().codepoint);
+    unsigned int index = c->get_coverage (this+coverage, buffer->cur().codepoint);
     if (likely (index == NOT_COVERED)) return TRACE_RETURN (false);
 
     if (likely (index >= valueCount)) return TRACE_RETURN (false);
@@ -565,6 +565,49 @@ struct PairValueRecord
   DEFINE_SIZE_ARRAY (2, values);
 };
 
+struct PairPosFormat1;
+
+/* Collects the PairValueRecords of PairPos format 1 subtables, for
+ * hashing by PairSet and second glyph. */
+struct hb_collect_pairs_context_t
+{
+  inline const char *get_name (void) { return "COLLECT_PAIRS"; }
+  static const unsigned int max_debug_depth = 0;
+  typedef hb_void_t return_t;
+  template <typename T>
+  inline return_t dispatch (const T &obj HB_UNUSED) { return HB_VOID; }
+  inline return_t dispatch (const PairPosFormat1 &obj);
+  static return_t default_return_value (void) { return HB_VOID; }
+  bool stop_sublookup_iteration (return_t r HB_UNUSED) const { return false; }
+
+  inline void add (const void *pair_set, unsigned int record_size,
+		   hb_codepoint_t second, const void *record)
+  {
+    hb_ot_layout_pair_t *pair = pairs->push ();
+    if (unlikely (!pair))
+      in_error = true;
+    else
+    {
+      pair->pair_set = (const char *) pair_set - base;
+      pair->second = second;
+      pair->record_size = record_size;
+      pair->record = (const char *) record - base;
+    }
+  }
+
+  hb_collect_pairs_context_t (const void *base_,
+			      hb_prealloced_array_t<hb_ot_layout_pair_t, 32> *pairs_) :
+			      base ((const char *) base_),
+			      pairs (pairs_),
+			      in_error (false),
+			      debug_depth (0) {}
+
+  const char *base;
+  hb_prealloced_array_t<hb_ot_layout_pair_t, 32> *pairs;
+  bool in_error; /* Some records could not be collected. */
+  unsigned int debug_depth;
+};
+
 struct PairSet
 {
   friend struct PairPosFormat1;
@@ -586,12 +629,9 @@ struct PairSet
     }
   }
 
-  inline bool apply (hb_apply_context_t *c,
-		     const ValueFormat *valueFormats,
-		     unsigned int pos) const
+  inline void collect_pairs (hb_collect_pairs_context_t *c,
+			     const ValueFormat *valueFormats) const
   {
-    TRACE_APPLY (this);
-    hb_buffer_t *buffer = c->buffer;
     unsigned int len1 = valueFormats[0].get_len ();
     unsigned int len2 = valueFormats[1].get_len ();
     unsigned int record_size = USHORT::static_size * (1 + len1 + len2);
@@ -600,22 +640,50 @@ struct PairSet
     unsigned int count = len;
     for (unsigned int i = 0; i < count; i++)
     {
-      /* TODO bsearch */
-      if (buffer->info[pos].codepoint == record->secondGlyph)
-      {
-	valueFormats[0].apply_value (c->font, c->direction, this,
-				     &record->values[0], buffer->cur_pos());
-	valueFormats[1].apply_value (c->font, c->direction, this,
-				     &record->values[len1], buffer->pos[pos]);
-	if (len2)
-	  pos++;
-	buffer->idx = pos;
-	return TRACE_RETURN (true);
-      }
+      c->add (this, record_size, record->secondGlyph, record);
       record = &StructAtOffset<PairValueRecord> (record, record_size);
     }
+  }
 
-    return TRACE_RETURN (false);
+  inline const PairValueRecord *find_record (hb_codepoint_t second,
+					      unsigned int record_size) const
+  {
+    const PairValueRecord *record = CastP<PairValueRecord> (array);
+    unsigned int count = len;
+    for (unsigned int i = 0; i < count; i++)
+    {
+      if (second == record->secondGlyph)
+	return record;
+      record = &StructAtOffset<PairValueRecord> (record, record_size);
+    }
+    return NULL;
+  }
+
+  inline bool apply (hb_apply_context_t *c,
+		     const ValueFormat *valueFormats,
+		     unsigned int pos) const
+  {
+    TRACE_APPLY (this);
+    hb_buffer_t *buffer = c->buffer;
+    unsigned int len1 = valueFormats[0].get_len ();
+    unsigned int len2 = valueFormats[1].get_len ();
+    unsigned int record_size = USHORT::static_size * (1 + len1 + len2);
+
+    hb_codepoint_t second = buffer->info[pos].codepoint;
+    const PairValueRecord *record = c->accel && c->accel->pairs ?
+				    (const PairValueRecord *) c->accel->get_pair (this, record_size, second) :
+				    find_record (second, record_size);
+    if (!record)
+      return TRACE_RETURN (false);
+
+    valueFormats[0].apply_value (c->font, c->direction, this,
+				 &record->values[0], buffer->cur_pos());
+    valueFormats[1].apply_value (c->font, c->direction, this,
+				 &record->values[len1], buffer->pos[pos]);
+    if (len2)
+      pos++;
+    buffer->idx = pos;
+    return TRACE_RETURN (true);
   }
 
   struct sanitize_closure_t {
@@ -667,7 +735,7 @@ struct PairPosFormat1
     hb_apply_context_t::skipping_forward_iterator_t skippy_iter (c, buffer->idx, 1);
     if (skippy_iter.has_no_chance ()) return TRACE_RETURN (false);
 
-    unsigned int index = (this+coverage).get_coverage  (buffer->cur().codepoint);
+    unsigned int index = c->get_coverage (this+coverage, buffer->cur().codepoint);
     if (likely (index == NOT_COVERED)) return TRACE_RETURN (false);
 
     if (!skippy_iter.next ()) return TRACE_RETURN (false);
@@ -675,6 +743,13 @@ struct PairPosFormat1
     return TRACE_RETURN ((this+pairSet[index]).apply (c, &valueFormat1, skippy_iter.idx));
   }
 
+  inline void collect_pairs (hb_collect_pairs_context_t *c) const
+  {
+    unsigned int count = pairSet.len;
+    for (unsigned int i = 0; i < count; i++)
+      (this+pairSet[i]).collect_pairs (c, &valueFormat1);
+  }
+
   inline bool sanitize (hb_sanitize_context_t *c) {
     TRACE_SANITIZE (this);
 
@@ -708,6 +783,14 @@ struct PairPosFormat1
   DEFINE_SIZE_ARRAY (10, pairSet);
 };
 
+inline hb_collect_pairs_context_t::return_t
+hb_collect_pairs_context_t::dispatch (const PairPosFormat1 &obj)
+{
+  obj.collect_pairs (this);
+  return HB_VOID;
+}
+
+
 struct PairPosFormat2
 {
   inline void collect_glyphs (hb_collect_glyphs_context_t *c) const
@@ -726,6 +809,12 @@ struct PairPosFormat2
       klass2.add_class (c->input, i);
   }
 
+  inline void collect_class_defs (hb_collect_class_defs_context_t *c) const
+  {
+    c->add (this+classDef1);
+    c->add (this+classDef2);
+  }
+
   inline const Coverage &get_coverage (void) const
   {
     return this+coverage;
@@ -738,7 +827,7 @@ struct PairPosFormat2
     hb_apply_context_t::skipping_forward_iterator_t skippy_iter (c, buffer->idx, 1);
     if (skippy_iter.has_no_chance ()) return TRACE_RETURN (false);
 
-    unsigned int index = (this+coverage).get_coverage  (buffer->cur().codepoint);
+    unsigned int index = c->get_coverage (this+coverage, buffer->cur().codepoint);
     if (likely (index == NOT_COVERED)) return TRACE_RETURN (false);
 
     if (!skippy_iter.next ()) return TRACE_RETURN (false);
@@ -747,8 +836,8 @@ struct PairPosFormat2
     unsigned int len2 = valueFormat2.get_len ();
     unsigned int record_len = len1 + len2;
 
-    unsigned int klass1 = (this+classDef1).get_class (buffer->cur().codepoint);
-    unsigned int klass2 = (this+classDef2).get_class (buffer->info[skippy_iter.idx].codepoint);
+    unsigned int klass1 = c->get_class_map (this+classDef1).get_class (buffer->cur().codepoint);
+    unsigned int klass2 = c->get_class_map (this+classDef2).get_class (buffer->info[skippy_iter.idx].codepoint);
     if (unlikely (klass1 >= class1Count || klass2 >= class2Count)) return TRACE_RETURN (false);
 
     const Value *v = &values[record_len * (klass1 * class2Count + klass2)];
@@ -811,6 +900,13 @@ struct PairPosFormat2
   DEFINE_SIZE_ARRAY (16, values);
 };
 
+inline hb_collect_class_defs_context_t::return_t
+hb_collect_class_defs_context_t::dispatch (const PairPosFormat2 &obj)
+{
+  obj.collect_class_defs (this);
+  return HB_VOID;
+}
+
 struct PairPos
 {
   template <typename context_t>
@@ -889,12 +985,12 @@ struct CursivePosFormat1
     hb_apply_context_t::skipping_forward_iterator_t skippy_iter (c, buffer->idx, 1);
     if (skippy_iter.has_no_chance ()) return TRACE_RETURN (false);
 
-    const EntryExitRecord &this_record = entryExitRecord[(this+coverage).get_coverage  (buffer->cur().codepoint)];
+    const EntryExitRecord &this_record = entryExitRecord[c->get_coverage (this+coverage, buffer->cur().codepoint)];
     if (!this_record.exitAnchor) return TRACE_RETURN (false);
 
     if (!skippy_iter.next ()) return TRACE_RETURN (false);
 
-    const EntryExitRecord &next_record = entryExitRecord[(this+coverage).get_coverage  (buffer->info[skippy_iter.idx].codepoint)];
+    const EntryExitRecord &next_record = entryExitRecord[c->get_coverage (this+coverage, buffer->info[skippy_iter.idx].codepoint)];
     if (!next_record.entryAnchor) return TRACE_RETURN (false);
 
     unsigned int i = buffer->idx;
@@ -1030,7 +1126,7 @@ struct MarkBasePosFormat1
   {
     TRACE_APPLY (this);
     hb_buffer_t *buffer = c->buffer;
-    unsigned int mark_index = (this+markCoverage).get_coverage  (buffer->cur().codepoint);
+    unsigned int mark_index = c->get_coverage (this+markCoverage, buffer->cur().codepoint);
     if (likely (mark_index == NOT_COVERED)) return TRACE_RETURN (false);
 
     /* now we search backwards for a non-mark glyph */
@@ -1134,7 +1230,7 @@ struct MarkLigPosFormat1
   {
     TRACE_APPLY (this);
     hb_buffer_t *buffer = c->buffer;
-    unsigned int mark_index = (this+markCoverage).get_coverage  (buffer->cur().codepoint);
+    unsigned int mark_index = c->get_coverage (this+markCoverage, buffer->cur().codepoint);
     if (likely (mark_index == NOT_COVERED)) return TRACE_RETURN (false);
 
     /* now we search backwards for a non-mark glyph */
@@ -1250,7 +1346,7 @@ struct MarkMarkPosFormat1
   {
     TRACE_APPLY (this);
     hb_buffer_t *buffer = c->buffer;
-    unsigned int mark1_index = (this+mark1Coverage).get_coverage  (buffer->cur().codepoint);
+    unsigned int mark1_index = c->get_coverage (this+mark1Coverage, buffer->cur().codepoint);
     if (likely (mark1_index == NOT_COVERED)) return TRACE_RETURN (false);
 
     /* now we search backwards for a suitable mark glyph until a non-mark glyph */
@@ -1466,12 +1562,29 @@ struct PosLookup : Lookup
     }
   }
 
+  inline const Coverage &get_subtable_coverage (unsigned int i) const
+  {
+    hb_get_coverage_context_t c;
+    return get_subtable (i).dispatch (&c, get_type ());
+  }
+
   inline bool apply_once (hb_apply_context_t *c) const
   {
     TRACE_APPLY (this);
     if (!c->check_glyph_property (&c->buffer->cur(), c->lookup_props))
       return TRACE_RETURN (false);
-    return TRACE_RETURN (dispatch (c));
+    if (!c->coverage_maps)
+      return TRACE_RETURN (dispatch (c));
+
+    /* Same as dispatch(), pointing the context at each subtable's coverage map. */
+    unsigned int lookup_type = get_type ();
+    unsigned int count = get_subtable_count ();
+    for (unsigned int i = 0; i < count; i++) {
+      c->coverage_map = &c->coverage_maps[i];
+      if (get_subtable (i).dispatch (c, lookup_type))
+        return TRACE_RETURN (true);
+    }
+    return TRACE_RETURN (false);
   }
 
   static bool apply_recurse_func (hb_apply_context_t *c, unsigned int lookup_index);
@@ -1604,19 +1717,26 @@ GPOS::position_finish (hb_font_t *font HB_UNUSED, hb_buffer_t *buffer)
 template <typename context_t>
 inline typename context_t::return_t PosLookup::dispatch_recurse_func (context_t *c, unsigned int lookup_index)
 {
-  const GPOS &gpos = *(hb_ot_layout_from_face (c->face)->gpos);
+  const GPOS &gpos = hb_ot_layout_from_face (c->face)->get_gpos ();
   const PosLookup &l = gpos.get_lookup (lookup_index);
   return l.dispatch (c);
 }
 
 inline bool PosLookup::apply_recurse_func (hb_apply_context_t *c, unsigned int lookup_index)
 {
-  const GPOS &gpos = *(hb_ot_layout_from_face (c->face)->gpos);
-  const PosLookup &l = gpos.get_lookup (lookup_index);
+  hb_ot_layout_t *layout = hb_ot_layout_from_face (c->face);
+  const PosLookup &l = layout->get_gpos ().get_lookup (lookup_index);
   unsigned int saved_lookup_props = c->lookup_props;
+  const hb_ot_layout_lookup_accelerator_t *saved_accel = c->accel;
+  const hb_ot_layout_coverage_map_t *saved_coverage_maps = c->coverage_maps;
+  const hb_ot_layout_coverage_map_t *saved_coverage_map = c->coverage_map;
   c->set_lookup (l);
+  c->set_accel (&layout->get_accel (1, lookup_index));
   bool ret = l.apply_once (c);
   c->lookup_props = saved_lookup_props;
+  c->accel = saved_accel;
+  c->coverage_maps = saved_coverage_maps;
+  c->coverage_map = saved_coverage_map;
   return ret;
 }
 
@@ -74,7 +74,7 @@ struct SingleSubstFormat1
   {
     TRACE_APPLY (this);
     hb_codepoint_t glyph_id = c->buffer->cur().codepoint;
-    unsigned int index = (this+coverage).get_coverage (glyph_id);
+    unsigned int index = c->get_coverage (this+coverage, glyph_id);
     if (likely (index == NOT_COVERED)) return TRACE_RETURN (false);
 
     /* According to the Adobe Annotated OpenType Suite, result is always
@@ -150,7 +150,7 @@ struct SingleSubstFormat2
   {
     TRACE_APPLY (this);
     hb_codepoint_t glyph_id = c->buffer->cur().codepoint;
-    unsigned int index = (this+coverage).get_coverage (glyph_id);
+    unsigned int index = c->get_coverage (this+coverage, glyph_id);
     if (likely (index == NOT_COVERED)) return TRACE_RETURN (false);
 
     if (unlikely (index >= substitute.len)) return TRACE_RETURN (false);
@@ -349,7 +349,7 @@ struct MultipleSubstFormat1
   {
     TRACE_APPLY (this);
 
-    unsigned int index = (this+coverage).get_coverage (c->buffer->cur().codepoint);
+    unsigned int index = c->get_coverage (this+coverage, c->buffer->cur().codepoint);
     if (likely (index == NOT_COVERED)) return TRACE_RETURN (false);
 
     return TRACE_RETURN ((this+sequence[index]).apply (c));
@@ -483,7 +483,7 @@ struct AlternateSubstFormat1
     TRACE_APPLY (this);
     hb_codepoint_t glyph_id = c->buffer->cur().codepoint;
 
-    unsigned int index = (this+coverage).get_coverage (glyph_id);
+    unsigned int index = c->get_coverage (this+coverage, glyph_id);
     if (likely (index == NOT_COVERED)) return TRACE_RETURN (false);
 
     const AlternateSet &alt_set = this+alternateSet[index];
@@ -620,6 +620,12 @@ struct Ligature
     return TRACE_RETURN (true);
   }
 
+  /* Whether the ligature may match with second as its second glyph. */
+  inline bool may_match_second (hb_codepoint_t second) const
+  {
+    return component.len < 2 || component[1] == second;
+  }
+
   inline bool apply (hb_apply_context_t *c) const
   {
     TRACE_APPLY (this);
@@ -716,9 +722,30 @@ struct LigatureSet
   {
     TRACE_APPLY (this);
     unsigned int num_ligs = ligature.len;
+
+    /* The ligatures all match their second component against the first
+     * glyph the skippy iterator stops at, unless that is a default ignorable
+     * the iterator may skip instead.  Find it once, and only run match_input()
+     * for the ligatures whose second component it is. */
+    bool filter = false;
+    hb_codepoint_t second = (hb_codepoint_t) -1; /* Matches no component. */
+    if (num_ligs > 1)
+    {
+      hb_apply_context_t::skipping_forward_iterator_t skippy_iter (c, c->buffer->idx, 1);
+      skippy_iter.set_match_func (match_any, NULL, &Null(USHORT));
+      filter = true;
+      if (skippy_iter.next ())
+      {
+	const hb_glyph_info_t &info = c->buffer->info[skippy_iter.idx];
+	filter = !_hb_glyph_info_is_default_ignorable (&info);
+	second = info.codepoint;
+      }
+    }
+
     for (unsigned int i = 0; i < num_ligs; i++)
     {
       const Ligature &lig = this+ligature[i];
+      if (filter && !lig.may_match_second (second)) continue;
       if (lig.apply (c)) return TRACE_RETURN (true);
     }
 
@@ -799,7 +826,7 @@ struct LigatureSubstFormat1
     TRACE_APPLY (this);
     hb_codepoint_t glyph_id = c->buffer->cur().codepoint;
 
-    unsigned int index = (this+coverage).get_coverage (glyph_id);
+    unsigned int index = c->get_coverage (this+coverage, glyph_id);
     if (likely (index == NOT_COVERED)) return TRACE_RETURN (false);
 
     const LigatureSet &lig_set = this+ligatureSet[index];
@@ -973,7 +1000,7 @@ struct ReverseChainSingleSubstFormat1
     if (unlikely (c->nesting_level_left != MAX_NESTING_LEVEL))
       return TRACE_RETURN (false); /* No chaining to this type */
 
-    unsigned int index = (this+coverage).get_coverage (c->buffer->cur().codepoint);
+    unsigned int index = c->get_coverage (this+coverage, c->buffer->cur().codepoint);
     if (likely (index == NOT_COVERED)) return TRACE_RETURN (false);
 
     const OffsetArrayOf<Coverage> &lookahead = StructAfter<OffsetArrayOf<Coverage> > (backtrack);
@@ -1175,6 +1202,12 @@ struct SubstLookup : Lookup
     }
   }
 
+  inline const Coverage &get_subtable_coverage (unsigned int i) const
+  {
+    hb_get_coverage_context_t c;
+    return get_subtable (i).dispatch (&c, get_type ());
+  }
+
   inline bool would_apply (hb_would_apply_context_t *c, const hb_set_digest_t *digest) const
   {
     TRACE_WOULD_APPLY (this);
@@ -1188,7 +1221,18 @@ struct SubstLookup : Lookup
     TRACE_APPLY (this);
     if (!c->check_glyph_property (&c->buffer->cur(), c->lookup_props))
       return TRACE_RETURN (false);
-    return TRACE_RETURN (dispatch (c));
+    if (!c->coverage_maps)
+      return TRACE_RETURN (dispatch (c));
+
+    /* Same as dispatch(), pointing the context at each subtable's coverage map. */
+    unsigned int lookup_type = get_type ();
+    unsigned int count = get_subtable_count ();
+    for (unsigned int i = 0; i < count; i++) {
+      c->coverage_map = &c->coverage_maps[i];
+      if (get_subtable (i).dispatch (c, lookup_type))
+        return TRACE_RETURN (true);
+    }
+    return TRACE_RETURN (false);
   }
 
   static bool apply_recurse_func (hb_apply_context_t *c, unsigned int lookup_index);
@@ -1320,11 +1364,11 @@ GSUB::substitute_start (hb_font_t *font, hb_buffer_t *buffer)
 {
   _hb_buffer_allocate_gsubgpos_vars (buffer);
 
-  const GDEF &gdef = *hb_ot_layout_from_face (font->face)->gdef;
+  const hb_ot_layout_t *layout = hb_ot_layout_from_face (font->face);
   unsigned int count = buffer->len;
   for (unsigned int i = 0; i < count; i++)
   {
-    _hb_glyph_info_set_glyph_props (&buffer->info[i], gdef.get_glyph_props (buffer->info[i].codepoint));
+    _hb_glyph_info_set_glyph_props (&buffer->info[i], layout->get_glyph_props (buffer->info[i].codepoint));
     _hb_glyph_info_clear_lig_props (&buffer->info[i]);
     buffer->info[i].syllable() = 0;
   }
@@ -1349,19 +1393,26 @@ inline bool ExtensionSubst::is_reverse (void) const
 template <typename context_t>
 inline typename context_t::return_t SubstLookup::dispatch_recurse_func (context_t *c, unsigned int lookup_index)
 {
-  const GSUB &gsub = *(hb_ot_layout_from_face (c->face)->gsub);
+  const GSUB &gsub = hb_ot_layout_from_face (c->face)->get_gsub ();
   const SubstLookup &l = gsub.get_lookup (lookup_index);
   return l.dispatch (c);
 }
 
 inline bool SubstLookup::apply_recurse_func (hb_apply_context_t *c, unsigned int lookup_index)
 {
-  const GSUB &gsub = *(hb_ot_layout_from_face (c->face)->gsub);
-  const SubstLookup &l = gsub.get_lookup (lookup_index);
+  hb_ot_layout_t *layout = hb_ot_layout_from_face (c->face);
+  const SubstLookup &l = layout->get_gsub ().get_lookup (lookup_index);
   unsigned int saved_lookup_props = c->lookup_props;
+  const hb_ot_layout_lookup_accelerator_t *saved_accel = c->accel;
+  const hb_ot_layout_coverage_map_t *saved_coverage_maps = c->coverage_maps;
+  const hb_ot_layout_coverage_map_t *saved_coverage_map = c->coverage_map;
   c->set_lookup (l);
+  c->set_accel (&layout->get_accel (0, lookup_index));
   bool ret = l.apply_once (c);
   c->lookup_props = saved_lookup_props;
+  c->accel = saved_accel;
+  c->coverage_maps = saved_coverage_maps;
+  c->coverage_map = saved_coverage_map;
   return ret;
 }
 
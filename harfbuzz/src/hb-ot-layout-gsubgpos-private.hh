@@ -229,6 +229,41 @@ struct hb_get_coverage_context_t
 };
 
 
+struct ContextFormat2;
+struct ChainContextFormat2;
+struct PairPosFormat2;
+
+/* Collects the ClassDefs used by class-based contextual and pair
+ * positioning subtables, for flattening. */
+struct hb_collect_class_defs_context_t
+{
+  inline const char *get_name (void) { return "COLLECT_CLASS_DEFS"; }
+  static const unsigned int max_debug_depth = 0;
+  typedef hb_void_t return_t;
+  template <typename T>
+  inline return_t dispatch (const T &obj HB_UNUSED) { return HB_VOID; }
+  inline return_t dispatch (const ContextFormat2 &obj);
+  inline return_t dispatch (const ChainContextFormat2 &obj);
+  inline return_t dispatch (const PairPosFormat2 &obj);
+  static return_t default_return_value (void) { return HB_VOID; }
+  bool stop_sublookup_iteration (return_t r HB_UNUSED) const { return false; }
+
+  inline void add (const ClassDef &class_def)
+  {
+    const ClassDef **p = class_defs->push ();
+    if (likely (p))
+      *p = &class_def;
+  }
+
+  hb_collect_class_defs_context_t (hb_prealloced_array_t<const ClassDef *, 32> *class_defs_) :
+				   class_defs (class_defs_),
+				   debug_depth (0) {}
+
+  hb_prealloced_array_t<const ClassDef *, 32> *class_defs;
+  unsigned int debug_depth;
+};
+
+
 
 #ifndef HB_DEBUG_APPLY
 #define HB_DEBUG_APPLY (HB_DEBUG+0)
@@ -272,6 +307,10 @@ struct hb_apply_context_t
   unsigned int lookup_props;
   const GDEF &gdef;
   bool has_glyph_classes;
+  const hb_ot_layout_t *layout;
+  const hb_ot_layout_lookup_accelerator_t *accel; /* Of the current lookup. */
+  const hb_ot_layout_coverage_map_t *coverage_maps; /* Per subtable of the current lookup, or NULL. */
+  const hb_ot_layout_coverage_map_t *coverage_map; /* Of the current subtable. */
   unsigned int debug_depth;
 
 
@@ -288,6 +327,10 @@ struct hb_apply_context_t
 			lookup_props (0),
 			gdef (*hb_ot_layout_from_face (face)->gdef),
 			has_glyph_classes (gdef.has_glyph_classes ()),
+			layout (hb_ot_layout_from_face (face)),
+			accel (NULL),
+			coverage_maps (NULL),
+			coverage_map (NULL),
 			debug_depth (0) {}
 
   inline void set_lookup_mask (hb_mask_t mask) { lookup_mask = mask; }
@@ -295,6 +338,30 @@ struct hb_apply_context_t
   inline void set_recurse_func (recurse_func_t func) { recurse_func = func; }
   inline void set_lookup_props (unsigned int lookup_props_) { lookup_props = lookup_props_; }
   inline void set_lookup (const Lookup &l) { lookup_props = l.get_props (); }
+  inline void set_accel (const hb_ot_layout_lookup_accelerator_t *accel_)
+  {
+    accel = accel_;
+    coverage_maps = accel->coverage_maps;
+    coverage_map = NULL;
+  }
+
+  /* ClassDef lookup through the current lookup's flattened class maps, if any. */
+  inline ClassDefMap get_class_map (const ClassDef &class_def) const
+  {
+    if (accel)
+      return accel->get_class_map (class_def);
+    ClassDefMap map;
+    map.init (class_def);
+    return map;
+  }
+
+  /* Coverage lookup through the current subtable's coverage map, if any. */
+  inline unsigned int get_coverage (const Coverage &coverage, hb_codepoint_t glyph_id) const
+  {
+    if (coverage_map && coverage_map->coverage == &coverage)
+      return coverage_map->get_coverage (glyph_id);
+    return coverage.get_coverage (glyph_id);
+  }
 
   struct matcher_t
   {
@@ -575,7 +642,7 @@ struct hb_apply_context_t
     if (ligature)
       add_in |= HB_OT_LAYOUT_GLYPH_PROPS_LIGATED;
     if (likely (has_glyph_classes))
-      _hb_glyph_info_set_glyph_props (&buffer->cur(), add_in | gdef.get_glyph_props (glyph_index));
+      _hb_glyph_info_set_glyph_props (&buffer->cur(), add_in | layout->get_glyph_props (glyph_index));
     else if (class_guess)
       _hb_glyph_info_set_glyph_props (&buffer->cur(), add_in | class_guess);
   }
@@ -682,11 +749,20 @@ static inline bool match_glyph (hb_codepoint_t glyph_id, const USHORT &value, co
 {
   return glyph_id == value;
 }
+static inline bool match_any (hb_codepoint_t glyph_id HB_UNUSED, const USHORT &value HB_UNUSED, const void *data HB_UNUSED)
+{
+  return true;
+}
 static inline bool match_class (hb_codepoint_t glyph_id, const USHORT &value, const void *data)
 {
   const ClassDef &class_def = *reinterpret_cast<const ClassDef *>(data);
   return class_def.get_class (glyph_id) == value;
 }
+static inline bool match_class_map (hb_codepoint_t glyph_id, const USHORT &value, const void *data)
+{
+  const ClassDefMap &class_map = *reinterpret_cast<const ClassDefMap *>(data);
+  return class_map.get_class (glyph_id) == value;
+}
 static inline bool match_coverage (hb_codepoint_t glyph_id, const USHORT &value, const void *data)
 {
   const OffsetTo<Coverage> &coverage = (const OffsetTo<Coverage>&)value;
@@ -1282,7 +1358,7 @@ struct ContextFormat1
   inline bool apply (hb_apply_context_t *c) const
   {
     TRACE_APPLY (this);
-    unsigned int index = (this+coverage).get_coverage (c->buffer->cur().codepoint);
+    unsigned int index = c->get_coverage (this+coverage, c->buffer->cur().codepoint);
     if (likely (index == NOT_COVERED))
       return TRACE_RETURN (false);
 
@@ -1373,19 +1449,24 @@ struct ContextFormat2
   inline bool apply (hb_apply_context_t *c) const
   {
     TRACE_APPLY (this);
-    unsigned int index = (this+coverage).get_coverage (c->buffer->cur().codepoint);
+    unsigned int index = c->get_coverage (this+coverage, c->buffer->cur().codepoint);
     if (likely (index == NOT_COVERED)) return TRACE_RETURN (false);
 
-    const ClassDef &class_def = this+classDef;
-    index = class_def.get_class (c->buffer->cur().codepoint);
+    const ClassDefMap class_map = c->get_class_map (this+classDef);
+    index = class_map.get_class (c->buffer->cur().codepoint);
     const RuleSet &rule_set = this+ruleSet[index];
     struct ContextApplyLookupContext lookup_context = {
-      {match_class},
-      &class_def
+      {match_class_map},
+      &class_map
     };
     return TRACE_RETURN (rule_set.apply (c, lookup_context));
   }
 
+  inline void collect_class_defs (hb_collect_class_defs_context_t *c) const
+  {
+    c->add (this+classDef);
+  }
+
   inline bool sanitize (hb_sanitize_context_t *c) {
     TRACE_SANITIZE (this);
     return TRACE_RETURN (coverage.sanitize (c, this) && classDef.sanitize (c, this) && ruleSet.sanitize (c, this));
@@ -1463,7 +1544,7 @@ struct ContextFormat3
   inline bool apply (hb_apply_context_t *c) const
   {
     TRACE_APPLY (this);
-    unsigned int index = (this+coverage[0]).get_coverage (c->buffer->cur().codepoint);
+    unsigned int index = c->get_coverage (this+coverage[0], c->buffer->cur().codepoint);
     if (likely (index == NOT_COVERED)) return TRACE_RETURN (false);
 
     const LookupRecord *lookupRecord = &StructAtOffset<LookupRecord> (coverage, coverage[0].static_size * glyphCount);
@@ -1842,7 +1923,7 @@ struct ChainContextFormat1
   inline bool apply (hb_apply_context_t *c) const
   {
     TRACE_APPLY (this);
-    unsigned int index = (this+coverage).get_coverage (c->buffer->cur().codepoint);
+    unsigned int index = c->get_coverage (this+coverage, c->buffer->cur().codepoint);
     if (likely (index == NOT_COVERED)) return TRACE_RETURN (false);
 
     const ChainRuleSet &rule_set = this+ruleSet[index];
@@ -1945,24 +2026,31 @@ struct ChainContextFormat2
   inline bool apply (hb_apply_context_t *c) const
   {
     TRACE_APPLY (this);
-    unsigned int index = (this+coverage).get_coverage (c->buffer->cur().codepoint);
+    unsigned int index = c->get_coverage (this+coverage, c->buffer->cur().codepoint);
     if (likely (index == NOT_COVERED)) return TRACE_RETURN (false);
 
-    const ClassDef &backtrack_class_def = this+backtrackClassDef;
-    const ClassDef &input_class_def = this+inputClassDef;
-    const ClassDef &lookahead_class_def = this+lookaheadClassDef;
+    const ClassDefMap backtrack_class_map = c->get_class_map (this+backtrackClassDef);
+    const ClassDefMap input_class_map = c->get_class_map (this+inputClassDef);
+    const ClassDefMap lookahead_class_map = c->get_class_map (this+lookaheadClassDef);
 
-    index = input_class_def.get_class (c->buffer->cur().codepoint);
+    index = input_class_map.get_class (c->buffer->cur().codepoint);
     const ChainRuleSet &rule_set = this+ruleSet[index];
     struct ChainContextApplyLookupContext lookup_context = {
-      {match_class},
-      {&backtrack_class_def,
-       &input_class_def,
-       &lookahead_class_def}
+      {match_class_map},
+      {&backtrack_class_map,
+       &input_class_map,
+       &lookahead_class_map}
     };
     return TRACE_RETURN (rule_set.apply (c, lookup_context));
   }
 
+  inline void collect_class_defs (hb_collect_class_defs_context_t *c) const
+  {
+    c->add (this+backtrackClassDef);
+    c->add (this+inputClassDef);
+    c->add (this+lookaheadClassDef);
+  }
+
   inline bool sanitize (hb_sanitize_context_t *c) {
     TRACE_SANITIZE (this);
     return TRACE_RETURN (coverage.sanitize (c, this) && backtrackClassDef.sanitize (c, this) &&
@@ -1994,6 +2082,20 @@ struct ChainContextFormat2
   DEFINE_SIZE_ARRAY (12, ruleSet);
 };
 
+inline hb_collect_class_defs_context_t::return_t
+hb_collect_class_defs_context_t::dispatch (const ContextFormat2 &obj)
+{
+  obj.collect_class_defs (this);
+  return HB_VOID;
+}
+
+inline hb_collect_class_defs_context_t::return_t
+hb_collect_class_defs_context_t::dispatch (const ChainContextFormat2 &obj)
+{
+  obj.collect_class_defs (this);
+  return HB_VOID;
+}
+
 struct ChainContextFormat3
 {
   inline void closure (hb_closure_context_t *c) const
@@ -2068,7 +2170,7 @@ struct ChainContextFormat3
     TRACE_APPLY (this);
     const OffsetArrayOf<Coverage> &input = StructAfter<OffsetArrayOf<Coverage> > (backtrack);
 
-    unsigned int index = (this+input[0]).get_coverage (c->buffer->cur().codepoint);
+    unsigned int index = c->get_coverage (this+input[0], c->buffer->cur().codepoint);
     if (likely (index == NOT_COVERED)) return TRACE_RETURN (false);
 
     const OffsetArrayOf<Coverage> &lookahead = StructAfter<OffsetArrayOf<Coverage> > (input);
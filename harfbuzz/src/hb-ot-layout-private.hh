@@ -115,6 +115,125 @@ namespace OT {
   struct GDEF;
   struct GSUB;
   struct GPOS;
+  struct ClassDef;
+  struct ClassDefMap;
+}
+
+/* The budgets below are shared by all lookups of a face, and taken from as
+ * each lookup is first used. */
+
+/* Upper bound, in bytes per face, of the memory used to flatten the
+ * ClassDefs of contextual and pair positioning lookups into arrays. */
+#ifndef HB_OT_LAYOUT_CLASS_MAP_BUDGET
+#define HB_OT_LAYOUT_CLASS_MAP_BUDGET (1u << 20)
+#endif
+
+/* Upper bound, in bytes per face, of the memory used to flatten lookup
+ * coverages into bitmaps.  Lookups that don't fit keep the binary search. */
+#ifndef HB_OT_LAYOUT_COVERAGE_MAP_BUDGET
+#define HB_OT_LAYOUT_COVERAGE_MAP_BUDGET (1u << 20)
+#endif
+
+/* Upper bound, in bytes per face, of the hash tables of PairPos format 1
+ * records.  Lookups with more pairs than fit keep the linear PairSet scan. */
+#ifndef HB_OT_LAYOUT_PAIR_BUDGET
+#define HB_OT_LAYOUT_PAIR_BUDGET (1u << 20)
+#endif
+
+/* A PairValueRecord of a GPOS PairSet, hashed by PairSet and second glyph.
+ * Offsets are from the start of the lookup; a zero pair_set marks an empty
+ * slot. */
+struct hb_ot_layout_pair_t
+{
+  static inline unsigned int hash (unsigned int pair_set, hb_codepoint_t second)
+  { return (pair_set * 31 + second) * 2654435761u; }
+
+  uint32_t pair_set;
+  uint16_t second;
+  uint16_t record_size;
+  uint32_t record;
+};
+
+/* A Coverage table flattened into a bitmap of the covered glyphs, plus the
+ * coverage index of the first covered glyph of each 32-glyph word: both
+ * hits and misses are then answered in constant time. */
+struct hb_ot_layout_coverage_map_t
+{
+  /* Returns false if the coverage can't be flattened (glyphs out of range,
+   * or coverage indices not in glyph order); lookup_bits is then no longer
+   * valid, and the walk stops there: a malformed coverage with overlapping
+   * ranges could otherwise take billions of steps. */
+  template <typename TCoverage>
+  inline bool init (const TCoverage &coverage_,
+		    unsigned int num_glyphs_,
+		    uint32_t *bits_,
+		    uint16_t *base_,
+		    uint32_t *lookup_bits,
+		    bool *lookup_bits_valid)
+  {
+    coverage = NULL;
+    num_glyphs = num_glyphs_;
+    bits = bits_;
+    base = base_;
+
+    unsigned int count = 0;
+    hb_codepoint_t last = 0;
+    typename TCoverage::Iter iter;
+    for (iter.init (coverage_); iter.more (); iter.next ())
+    {
+      hb_codepoint_t glyph = iter.get_glyph ();
+      if (unlikely (glyph >= num_glyphs ||
+		    iter.get_coverage () != count || (count && glyph <= last)))
+      {
+	*lookup_bits_valid = false;
+	return false;
+      }
+      last = glyph;
+      bits_[glyph >> 5] |= 1u << (glyph & 31);
+      lookup_bits[glyph >> 5] |= 1u << (glyph & 31);
+      count++;
+    }
+
+    unsigned int words = (num_glyphs + 31) / 32;
+    unsigned int index = 0;
+    for (unsigned int i = 0; i < words; i++)
+    {
+      base_[i] = index;
+      index += _hb_popcount32 (bits_[i]);
+    }
+
+    coverage = &coverage_;
+    return true;
+  }
+
+  inline unsigned int get_coverage (hb_codepoint_t glyph_id) const
+  {
+    if (unlikely (glyph_id >= num_glyphs))
+      return (unsigned int) -1; /* NOT_COVERED */
+    uint32_t word = bits[glyph_id >> 5];
+    uint32_t mask = 1u << (glyph_id & 31);
+    if (!(word & mask))
+      return (unsigned int) -1; /* NOT_COVERED */
+    return base[glyph_id >> 5] + _hb_popcount32 (word & (mask - 1));
+  }
+
+  const void *coverage; /* The Coverage table flattened here; NULL if not flattened. */
+  unsigned int num_glyphs;
+  const uint32_t *bits;
+  const uint16_t *base;
+};
+
+/* Takes size bytes from budget; returns false, taking nothing, if there
+ * isn't that much left. */
+static inline bool
+_hb_ot_layout_take_budget (hb_atomic_int_t *budget, unsigned int size)
+{
+  if (unlikely ((int) size < 0))
+    return false;
+  if (hb_atomic_int_add (*budget, -(int) size) >= (int) size)
+    return true;
+  hb_atomic_int_add (*budget, (int) size);
+  return false;
 }
 
 struct hb_ot_layout_lookup_accelerator_t
@@ -124,31 +243,173 @@ struct hb_ot_layout_lookup_accelerator_t
   {
     digest.init ();
     lookup.add_coverage (&digest);
+    num_glyphs = 0;
+    bits = NULL;
+    coverage_maps = NULL;
+    class_maps = NULL;
+    class_maps_mask = 0;
+    pairs = NULL;
+    pairs_mask = 0;
+    pairs_base = NULL;
   }
 
+  /* Flattens the coverage of the lookup and of each of its subtables, if
+   * that fits in the remaining budget, which is taken from. */
   template <typename TLookup>
-  inline void fini (const TLookup &lookup)
+  inline void init_coverage_maps (const TLookup &lookup,
+				  unsigned int num_glyphs_,
+				  hb_atomic_int_t *budget)
+  {
+    unsigned int count = lookup.get_subtable_count ();
+    if (unlikely (!count || !num_glyphs_ || num_glyphs_ > 0x10000u))
+      return;
+
+    unsigned int distinct = 0;
+    for (unsigned int i = 0; i < count; i++)
+      if (!i || &lookup.get_subtable_coverage (i) != &lookup.get_subtable_coverage (i - 1))
+	distinct++;
+
+    unsigned int words = (num_glyphs_ + 31) / 32;
+    unsigned int size = count * sizeof (hb_ot_layout_coverage_map_t) +
+			(1 + distinct) * words * sizeof (uint32_t) +
+			distinct * words * sizeof (uint16_t);
+    if (!_hb_ot_layout_take_budget (budget, size))
+      return;
+    char *data = (char *) calloc (1, size);
+    if (unlikely (!data))
+      return;
+
+    hb_ot_layout_coverage_map_t *maps = (hb_ot_layout_coverage_map_t *) data;
+    uint32_t *lookup_bits = (uint32_t *) (maps + count);
+    uint32_t *map_bits = lookup_bits + words;
+    uint16_t *map_base = (uint16_t *) (map_bits + distinct * words);
+    bool lookup_bits_valid = true;
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+      if (i && &lookup.get_subtable_coverage (i) == &lookup.get_subtable_coverage (i - 1))
+      {
+	maps[i] = maps[i - 1];
+	continue;
+      }
+      maps[i].init (lookup.get_subtable_coverage (i), num_glyphs_,
+		    map_bits, map_base, lookup_bits, &lookup_bits_valid);
+      map_bits += words;
+      map_base += words;
+    }
+
+    num_glyphs = num_glyphs_;
+    bits = lookup_bits_valid ? lookup_bits : NULL;
+    coverage_maps = maps;
+  }
+
+  template <typename TLookup>
+  inline void fini (const TLookup &lookup HB_UNUSED)
+  {
+    free (coverage_maps);
+    fini_class_maps ();
+    free (pairs);
+  }
+  inline void fini_class_maps (void);
+
+  inline bool may_have (hb_codepoint_t g) const
+  {
+    if (bits)
+      return g < num_glyphs && (bits[g >> 5] & (1u << (g & 31)));
+    return digest.may_have (g);
+  }
+
+  /* The flattened map of class_def, or a map falling back to class_def itself. */
+  inline OT::ClassDefMap get_class_map (const OT::ClassDef &class_def) const;
+
+  /* The record of pair_set for second, or NULL if it has none.  Only valid
+   * when pairs is not NULL. */
+  inline const void *get_pair (const void *pair_set, unsigned int record_size,
+			       hb_codepoint_t second) const
   {
+    unsigned int offset = (const char *) pair_set - pairs_base;
+    for (unsigned int i = hb_ot_layout_pair_t::hash (offset, second) & pairs_mask;
+	 pairs[i].pair_set;
+	 i = (i + 1) & pairs_mask)
+      if (pairs[i].pair_set == offset && pairs[i].second == second && pairs[i].record_size == record_size)
+	return pairs_base + pairs[i].record;
+    return NULL;
   }
 
   hb_set_digest_t digest;
+  unsigned int num_glyphs;
+  const uint32_t *bits; /* Glyphs covered by any subtable; NULL if not flattened. */
+  hb_ot_layout_coverage_map_t *coverage_maps; /* One per subtable; NULL if not flattened. */
+  OT::ClassDefMap *class_maps; /* Hashed by ClassDef address; NULL if none flattened. */
+  unsigned int class_maps_mask;
+  hb_ot_layout_pair_t *pairs; /* Every PairPos format 1 record of the lookup; NULL if not hashed. */
+  unsigned int pairs_mask;
+  const char *pairs_base; /* The lookup. */
 };
 
+/* A GSUB or GPOS table, and its lookup accelerators. */
+struct hb_ot_layout_table_t
+{
+  hb_blob_t *blob;
+  const void *table; /* The OT::GSUB or OT::GPOS. */
+  unsigned int lookup_count;
+  hb_ot_layout_lookup_accelerator_t **accels; /* Each NULL until its lookup is first used. */
+};
+
+struct hb_ot_layout_t;
+
+HB_INTERNAL const hb_ot_layout_table_t *
+_hb_ot_layout_load_table (hb_ot_layout_t *layout, unsigned int table_index);
+
+HB_INTERNAL const hb_ot_layout_lookup_accelerator_t *
+_hb_ot_layout_load_accel (hb_ot_layout_t *layout, unsigned int table_index, unsigned int lookup_index);
+
+/* GDEF is sanitized when the layout is created; GSUB and GPOS the first time
+ * they are used, and the accelerator of each of their lookups is built the
+ * first time the lookup is used.  A face can have thousands of lookups, of
+ * which a given text only uses a few. */
 struct hb_ot_layout_t
 {
-  hb_blob_t *gdef_blob;
-  hb_blob_t *gsub_blob;
-  hb_blob_t *gpos_blob;
+  hb_face_t *face; /* Not referenced: the face owns the layout. */
 
+  hb_blob_t *gdef_blob;
   const struct OT::GDEF *gdef;
-  const struct OT::GSUB *gsub;
-  const struct OT::GPOS *gpos;
 
-  unsigned int gsub_lookup_count;
-  unsigned int gpos_lookup_count;
+  hb_ot_layout_table_t *tables[2]; /* GSUB, GPOS; NULL until first used. */
+
+  hb_atomic_int_t coverage_map_budget;
+  hb_atomic_int_t class_map_budget;
+  hb_atomic_int_t pair_budget;
+
+  unsigned int num_glyphs;
+  uint16_t *glyph_props; /* GDEF glyph props of each glyph; NULL if not flattened. */
+
+  /* Same as GDEF::get_glyph_props(). */
+  inline unsigned int get_glyph_props (hb_codepoint_t glyph) const;
 
-  hb_ot_layout_lookup_accelerator_t *gsub_accels;
-  hb_ot_layout_lookup_accelerator_t *gpos_accels;
+  /* table_index is 0 for GSUB, 1 for GPOS. */
+  inline const hb_ot_layout_table_t &get_table (unsigned int table_index)
+  {
+    const hb_ot_layout_table_t *table = (const hb_ot_layout_table_t *) hb_atomic_ptr_get (&tables[table_index]);
+    if (unlikely (!table))
+      table = _hb_ot_layout_load_table (this, table_index);
+    return *table;
+  }
+  inline const OT::GSUB &get_gsub (void) { return *(const OT::GSUB *) get_table (0).table; }
+  inline const OT::GPOS &get_gpos (void) { return *(const OT::GPOS *) get_table (1).table; }
+
+  /* The accelerator of a lookup; an empty one if lookup_index is out of range. */
+  inline const hb_ot_layout_lookup_accelerator_t &get_accel (unsigned int table_index,
+							     unsigned int lookup_index)
+  {
+    const hb_ot_layout_table_t &table = get_table (table_index);
+    const hb_ot_layout_lookup_accelerator_t *accel = NULL;
+    if (likely (lookup_index < table.lookup_count))
+      accel = (const hb_ot_layout_lookup_accelerator_t *) hb_atomic_ptr_get (&table.accels[lookup_index]);
+    if (unlikely (!accel))
+      accel = _hb_ot_layout_load_accel (this, table_index, lookup_index);
+    return *accel;
+  }
 };
 
 
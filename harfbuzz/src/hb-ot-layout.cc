@@ -43,6 +43,116 @@
 
 HB_SHAPER_DATA_ENSURE_DECLARE(ot, face)
 
+static void
+_hb_ot_layout_flatten_glyph_props (hb_ot_layout_t *layout)
+{
+  if (!layout->gdef->has_glyph_classes () || !layout->num_glyphs || layout->num_glyphs > 0x10000u)
+    return;
+
+  layout->glyph_props = (uint16_t *) malloc (layout->num_glyphs * sizeof (uint16_t));
+  if (unlikely (!layout->glyph_props))
+    return;
+
+  for (unsigned int i = 0; i < layout->num_glyphs; i++)
+    layout->glyph_props[i] = layout->gdef->get_glyph_props (i);
+}
+
+/* Flattens the ClassDefs of the lookup, those that fit in the budget. */
+template <typename TLookup>
+static void
+_hb_ot_layout_flatten_class_defs (hb_ot_layout_t *layout,
+				  const TLookup &lookup,
+				  hb_ot_layout_lookup_accelerator_t *accel)
+{
+  if (!layout->num_glyphs || layout->num_glyphs > 0x10000u)
+    return;
+
+  hb_prealloced_array_t<const OT::ClassDef *, 32> class_defs;
+  class_defs.init ();
+  OT::hb_collect_class_defs_context_t c (&class_defs);
+  lookup.dispatch (&c);
+
+  if (class_defs.len)
+  {
+    unsigned int size = 1;
+    while (size < 2 * class_defs.len)
+      size <<= 1;
+    accel->class_maps = (OT::ClassDefMap *) calloc (size, sizeof (OT::ClassDefMap));
+    accel->class_maps_mask = size - 1;
+  }
+
+  unsigned int map_size = layout->num_glyphs * sizeof (uint16_t);
+  for (unsigned int i = 0; accel->class_maps && i < class_defs.len; i++)
+  {
+    const OT::ClassDef *class_def = class_defs[i];
+    unsigned int j = OT::ClassDefMap::hash (class_def) & accel->class_maps_mask;
+    while (accel->class_maps[j].class_def && accel->class_maps[j].class_def != class_def)
+      j = (j + 1) & accel->class_maps_mask;
+    if (accel->class_maps[j].class_def)
+      continue; /* Shared with an earlier subtable. */
+
+    if (!_hb_ot_layout_take_budget (&layout->class_map_budget, map_size))
+      break;
+    uint16_t *classes = (uint16_t *) calloc (layout->num_glyphs, sizeof (uint16_t));
+    if (unlikely (!classes) || !class_def->flatten (classes, layout->num_glyphs))
+    {
+      free (classes);
+      hb_atomic_int_add (layout->class_map_budget, (int) map_size);
+      continue;
+    }
+
+    accel->class_maps[j].init (*class_def);
+    accel->class_maps[j].num_glyphs = layout->num_glyphs;
+    accel->class_maps[j].classes = classes;
+  }
+
+  class_defs.finish ();
+}
+
+/* Hashes the PairPos format 1 records of the lookup, if they fit in the budget. */
+static void
+_hb_ot_layout_hash_pairs (hb_ot_layout_t *layout,
+			  const OT::PosLookup &lookup,
+			  hb_ot_layout_lookup_accelerator_t *accel)
+{
+  hb_prealloced_array_t<hb_ot_layout_pair_t, 32> pairs;
+  pairs.init ();
+  OT::hb_collect_pairs_context_t c (&lookup, &pairs);
+  lookup.dispatch (&c);
+
+  unsigned int size = 1;
+  while (size < pairs.len + pairs.len / 2)
+    size <<= 1;
+  if (pairs.len && !c.in_error &&
+      _hb_ot_layout_take_budget (&layout->pair_budget, size * sizeof (hb_ot_layout_pair_t)))
+  {
+    accel->pairs = (hb_ot_layout_pair_t *) calloc (size, sizeof (hb_ot_layout_pair_t));
+    if (unlikely (!accel->pairs))
+      hb_atomic_int_add (layout->pair_budget, (int) (size * sizeof (hb_ot_layout_pair_t)));
+  }
+
+  if (accel->pairs)
+  {
+    accel->pairs_mask = size - 1;
+    accel->pairs_base = (const char *) &lookup;
+    for (unsigned int i = 0; i < pairs.len; i++)
+    {
+      const hb_ot_layout_pair_t &pair = pairs[i];
+      unsigned int j = hb_ot_layout_pair_t::hash (pair.pair_set, pair.second) & accel->pairs_mask;
+      while (accel->pairs[j].pair_set &&
+	     !(accel->pairs[j].pair_set == pair.pair_set &&
+	       accel->pairs[j].second == pair.second &&
+	       accel->pairs[j].record_size == pair.record_size))
+	j = (j + 1) & accel->pairs_mask;
+      /* Keep the first record of duplicates, like the PairSet scan. */
+      if (!accel->pairs[j].pair_set)
+	accel->pairs[j] = pair;
+    }
+  }
+
+  pairs.finish ();
+}
+
 hb_ot_layout_t *
 _hb_ot_layout_create (hb_face_t *face)
 {
@@ -50,50 +160,141 @@ _hb_ot_layout_create (hb_face_t *face)
   if (unlikely (!layout))
     return NULL;
 
+  layout->face = face;
+
   layout->gdef_blob = OT::Sanitizer<OT::GDEF>::sanitize (face->reference_table (HB_OT_TAG_GDEF));
   layout->gdef = OT::Sanitizer<OT::GDEF>::lock_instance (layout->gdef_blob);
 
-  layout->gsub_blob = OT::Sanitizer<OT::GSUB>::sanitize (face->reference_table (HB_OT_TAG_GSUB));
-  layout->gsub = OT::Sanitizer<OT::GSUB>::lock_instance (layout->gsub_blob);
+  layout->coverage_map_budget = HB_OT_LAYOUT_COVERAGE_MAP_BUDGET;
+  layout->class_map_budget = HB_OT_LAYOUT_CLASS_MAP_BUDGET;
+  layout->pair_budget = HB_OT_LAYOUT_PAIR_BUDGET;
+
+  layout->num_glyphs = face->get_num_glyphs ();
+  _hb_ot_layout_flatten_glyph_props (layout);
+
+  return layout;
+}
+
+static const hb_ot_layout_table_t _hb_ot_layout_table_nil = {NULL, &OT::Null(OT::GSUBGPOS), 0, NULL};
+static hb_ot_layout_lookup_accelerator_t _hb_ot_layout_accel_nil; /* Zero: covers no glyph. */
 
-  layout->gpos_blob = OT::Sanitizer<OT::GPOS>::sanitize (face->reference_table (HB_OT_TAG_GPOS));
-  layout->gpos = OT::Sanitizer<OT::GPOS>::lock_instance (layout->gpos_blob);
+const hb_ot_layout_table_t *
+_hb_ot_layout_load_table (hb_ot_layout_t *layout, unsigned int table_index)
+{
+  hb_ot_layout_table_t *table = (hb_ot_layout_table_t *) calloc (1, sizeof (hb_ot_layout_table_t));
+  if (unlikely (!table))
+    return &_hb_ot_layout_table_nil;
 
-  layout->gsub_lookup_count = layout->gsub->get_lookup_count ();
-  layout->gpos_lookup_count = layout->gpos->get_lookup_count ();
+  if (table_index == 0)
+  {
+    table->blob = OT::Sanitizer<OT::GSUB>::sanitize (layout->face->reference_table (HB_OT_TAG_GSUB));
+    const OT::GSUB *gsub = OT::Sanitizer<OT::GSUB>::lock_instance (table->blob);
+    table->table = gsub;
+    table->lookup_count = gsub->get_lookup_count ();
+  }
+  else
+  {
+    table->blob = OT::Sanitizer<OT::GPOS>::sanitize (layout->face->reference_table (HB_OT_TAG_GPOS));
+    const OT::GPOS *gpos = OT::Sanitizer<OT::GPOS>::lock_instance (table->blob);
+    table->table = gpos;
+    table->lookup_count = gpos->get_lookup_count ();
+  }
 
-  layout->gsub_accels = (hb_ot_layout_lookup_accelerator_t *) calloc (layout->gsub->get_lookup_count (), sizeof (hb_ot_layout_lookup_accelerator_t));
-  layout->gpos_accels = (hb_ot_layout_lookup_accelerator_t *) calloc (layout->gpos->get_lookup_count (), sizeof (hb_ot_layout_lookup_accelerator_t));
+  table->accels = (hb_ot_layout_lookup_accelerator_t **) calloc (table->lookup_count, sizeof (hb_ot_layout_lookup_accelerator_t *));
+  if (unlikely (table->lookup_count && !table->accels))
+  {
+    hb_blob_destroy (table->blob);
+    free (table);
+    return &_hb_ot_layout_table_nil;
+  }
 
-  if (unlikely ((layout->gsub_lookup_count && !layout->gsub_accels) ||
-		(layout->gpos_lookup_count && !layout->gpos_accels)))
+  if (!hb_atomic_ptr_cmpexch (&layout->tables[table_index], NULL, table))
   {
-    _hb_ot_layout_destroy (layout);
-    return NULL;
+    /* Another thread loaded it first. */
+    free (table->accels);
+    hb_blob_destroy (table->blob);
+    free (table);
+    table = (hb_ot_layout_table_t *) hb_atomic_ptr_get (&layout->tables[table_index]);
   }
 
-  for (unsigned int i = 0; i < layout->gsub_lookup_count; i++)
-    layout->gsub_accels[i].init (layout->gsub->get_lookup (i));
-  for (unsigned int i = 0; i < layout->gpos_lookup_count; i++)
-    layout->gpos_accels[i].init (layout->gpos->get_lookup (i));
+  return table;
+}
 
-  return layout;
+template <typename TLookup>
+static void
+_hb_ot_layout_fini_accel (const TLookup &lookup, hb_ot_layout_lookup_accelerator_t *accel)
+{
+  if (accel)
+    accel->fini (lookup);
+  free (accel);
+}
+
+const hb_ot_layout_lookup_accelerator_t *
+_hb_ot_layout_load_accel (hb_ot_layout_t *layout, unsigned int table_index, unsigned int lookup_index)
+{
+  const hb_ot_layout_table_t &table = layout->get_table (table_index);
+  if (unlikely (lookup_index >= table.lookup_count))
+    return &_hb_ot_layout_accel_nil;
+
+  hb_ot_layout_lookup_accelerator_t *accel = (hb_ot_layout_lookup_accelerator_t *) calloc (1, sizeof (hb_ot_layout_lookup_accelerator_t));
+  if (unlikely (!accel))
+    return &_hb_ot_layout_accel_nil;
+
+  if (table_index == 0)
+  {
+    const OT::SubstLookup &lookup = layout->get_gsub ().get_lookup (lookup_index);
+    accel->init (lookup);
+    accel->init_coverage_maps (lookup, layout->num_glyphs, &layout->coverage_map_budget);
+    _hb_ot_layout_flatten_class_defs (layout, lookup, accel);
+  }
+  else
+  {
+    const OT::PosLookup &lookup = layout->get_gpos ().get_lookup (lookup_index);
+    accel->init (lookup);
+    accel->init_coverage_maps (lookup, layout->num_glyphs, &layout->coverage_map_budget);
+    _hb_ot_layout_flatten_class_defs (layout, lookup, accel);
+    _hb_ot_layout_hash_pairs (layout, lookup, accel);
+  }
+
+  if (!hb_atomic_ptr_cmpexch (&table.accels[lookup_index], NULL, accel))
+  {
+    /* Another thread built it first; the budget this one took is not given back. */
+    if (table_index == 0)
+      _hb_ot_layout_fini_accel (layout->get_gsub ().get_lookup (lookup_index), accel);
+    else
+      _hb_ot_layout_fini_accel (layout->get_gpos ().get_lookup (lookup_index), accel);
+    accel = (hb_ot_layout_lookup_accelerator_t *) hb_atomic_ptr_get (&table.accels[lookup_index]);
+  }
+
+  return accel;
 }
 
 void
 _hb_ot_layout_destroy (hb_ot_layout_t *layout)
 {
-  for (unsigned int i = 0; i < layout->gsub_lookup_count; i++)
-    layout->gsub_accels[i].fini (layout->gsub->get_lookup (i));
-  for (unsigned int i = 0; i < layout->gpos_lookup_count; i++)
-    layout->gpos_accels[i].fini (layout->gpos->get_lookup (i));
+  if (layout->tables[0])
+  {
+    const OT::GSUB &gsub = layout->get_gsub ();
+    for (unsigned int i = 0; i < layout->tables[0]->lookup_count; i++)
+      _hb_ot_layout_fini_accel (gsub.get_lookup (i), layout->tables[0]->accels[i]);
+  }
+  if (layout->tables[1])
+  {
+    const OT::GPOS &gpos = layout->get_gpos ();
+    for (unsigned int i = 0; i < layout->tables[1]->lookup_count; i++)
+      _hb_ot_layout_fini_accel (gpos.get_lookup (i), layout->tables[1]->accels[i]);
+  }
+  for (unsigned int i = 0; i < ARRAY_LENGTH (layout->tables); i++)
+    if (layout->tables[i])
+    {
+      free (layout->tables[i]->accels);
+      hb_blob_destroy (layout->tables[i]->blob);
+      free (layout->tables[i]);
+    }
 
-  free (layout->gsub_accels);
-  free (layout->gpos_accels);
+  free (layout->glyph_props);
 
   hb_blob_destroy (layout->gdef_blob);
-  hb_blob_destroy (layout->gsub_blob);
-  hb_blob_destroy (layout->gpos_blob);
 
   free (layout);
 }
@@ -108,13 +309,13 @@ static inline const OT::GSUB&
 _get_gsub (hb_face_t *face)
 {
   if (unlikely (!hb_ot_shaper_face_data_ensure (face))) return OT::Null(OT::GSUB);
-  return *hb_ot_layout_from_face (face)->gsub;
+  return hb_ot_layout_from_face (face)->get_gsub ();
 }
 static inline const OT::GPOS&
 _get_gpos (hb_face_t *face)
 {
   if (unlikely (!hb_ot_shaper_face_data_ensure (face))) return OT::Null(OT::GPOS);
-  return *hb_ot_layout_from_face (face)->gpos;
+  return hb_ot_layout_from_face (face)->get_gpos ();
 }
 
 
@@ -422,11 +623,11 @@ hb_ot_layout_table_get_lookup_count (hb_face_t    *face,
   {
     case HB_OT_TAG_GSUB:
     {
-      return hb_ot_layout_from_face (face)->gsub_lookup_count;
+      return hb_ot_layout_from_face (face)->get_table (0).lookup_count;
     }
     case HB_OT_TAG_GPOS:
     {
-      return hb_ot_layout_from_face (face)->gpos_lookup_count;
+      return hb_ot_layout_from_face (face)->get_table (1).lookup_count;
     }
   }
   return 0;
@@ -632,13 +833,13 @@ hb_ot_layout_lookup_collect_glyphs (hb_face_t    *face,
   {
     case HB_OT_TAG_GSUB:
     {
-      const OT::SubstLookup& l = hb_ot_layout_from_face (face)->gsub->get_lookup (lookup_index);
+      const OT::SubstLookup& l = hb_ot_layout_from_face (face)->get_gsub ().get_lookup (lookup_index);
       l.collect_glyphs (&c);
       return;
     }
     case HB_OT_TAG_GPOS:
     {
-      const OT::PosLookup& l = hb_ot_layout_from_face (face)->gpos->get_lookup (lookup_index);
+      const OT::PosLookup& l = hb_ot_layout_from_face (face)->get_gpos ().get_lookup (lookup_index);
       l.collect_glyphs (&c);
       return;
     }
@@ -674,12 +875,13 @@ hb_ot_layout_lookup_would_substitute_fast (hb_face_t            *face,
 					   unsigned int          glyphs_length,
 					   hb_bool_t             zero_context)
 {
-  if (unlikely (lookup_index >= hb_ot_layout_from_face (face)->gsub_lookup_count)) return false;
+  hb_ot_layout_t *layout = hb_ot_layout_from_face (face);
+  if (unlikely (lookup_index >= layout->get_table (0).lookup_count)) return false;
   OT::hb_would_apply_context_t c (face, glyphs, glyphs_length, zero_context);
 
-  const OT::SubstLookup& l = hb_ot_layout_from_face (face)->gsub->get_lookup (lookup_index);
+  const OT::SubstLookup& l = layout->get_gsub ().get_lookup (lookup_index);
 
-  return l.would_apply (&c, &hb_ot_layout_from_face (face)->gsub_accels[lookup_index].digest);
+  return l.would_apply (&c, &layout->get_accel (0, lookup_index).digest);
 }
 
 void
@@ -787,11 +989,11 @@ struct GSUBProxy
   typedef OT::SubstLookup Lookup;
 
   GSUBProxy (hb_face_t *face) :
-    table (*hb_ot_layout_from_face (face)->gsub),
-    accels (hb_ot_layout_from_face (face)->gsub_accels) {}
+    layout (hb_ot_layout_from_face (face)),
+    table (layout->get_gsub ()) {}
 
+  hb_ot_layout_t *layout;
   const OT::GSUB &table;
-  const hb_ot_layout_lookup_accelerator_t *accels;
 };
 
 struct GPOSProxy
@@ -801,23 +1003,14 @@ struct GPOSProxy
   typedef OT::PosLookup Lookup;
 
   GPOSProxy (hb_face_t *face) :
-    table (*hb_ot_layout_from_face (face)->gpos),
-    accels (hb_ot_layout_from_face (face)->gpos_accels) {}
+    layout (hb_ot_layout_from_face (face)),
+    table (layout->get_gpos ()) {}
 
+  hb_ot_layout_t *layout;
   const OT::GPOS &table;
-  const hb_ot_layout_lookup_accelerator_t *accels;
 };
 
 
-template <typename Lookup>
-static inline bool apply_once (OT::hb_apply_context_t *c,
-			       const Lookup &lookup)
-{
-  if (!c->check_glyph_property (&c->buffer->cur(), c->lookup_props))
-    return false;
-  return lookup.dispatch (c);
-}
-
 template <typename Proxy>
 static inline bool
 apply_string (OT::hb_apply_context_t *c,
@@ -831,6 +1024,7 @@ apply_string (OT::hb_apply_context_t *c,
     return false;
 
   c->set_lookup (lookup);
+  c->set_accel (&accel);
 
   if (likely (!lookup.is_reverse ()))
   {
@@ -841,9 +1035,9 @@ apply_string (OT::hb_apply_context_t *c,
 
     while (buffer->idx < buffer->len)
     {
-      if (accel.digest.may_have (buffer->cur().codepoint) &&
+      if (accel.may_have (buffer->cur().codepoint) &&
 	  (buffer->cur().mask & c->lookup_mask) &&
-	  apply_once (c, lookup))
+	  lookup.apply_once (c))
 	ret = true;
       else
 	buffer->next_glyph ();
@@ -864,9 +1058,9 @@ apply_string (OT::hb_apply_context_t *c,
     buffer->idx = buffer->len - 1;
     do
     {
-      if (accel.digest.may_have (buffer->cur().codepoint) &&
+      if (accel.may_have (buffer->cur().codepoint) &&
 	  (buffer->cur().mask & c->lookup_mask) &&
-	  apply_once (c, lookup))
+	  lookup.apply_once (c))
 	ret = true;
       /* The reverse lookup doesn't "advance" cursor (for good reason). */
       buffer->idx--;
@@ -898,7 +1092,7 @@ inline void hb_ot_map_t::apply (const Proxy &proxy,
       c.set_auto_zwj (lookups[table_index][i].auto_zwj);
       apply_string<Proxy> (&c,
 			   proxy.table.get_lookup (lookup_index),
-			   proxy.accels[lookup_index]);
+			   proxy.layout->get_accel (table_index, lookup_index));
     }
 
     if (stage->pause_func)
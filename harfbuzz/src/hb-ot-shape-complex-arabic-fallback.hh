@@ -53,8 +53,7 @@ enum {
 };
 
 static OT::SubstLookup *
-arabic_fallback_synthesize_lookup_single (const hb_ot_shape_plan_t *plan HB_UNUSED,
-					  hb_font_t *font,
+arabic_fallback_synthesize_lookup_single (hb_font_t *font,
 					  unsigned int feature_index)
 {
   OT::GlyphID glyphs[SHAPING_TABLE_LAST - SHAPING_TABLE_FIRST + 1];
@@ -103,8 +102,7 @@ arabic_fallback_synthesize_lookup_single (const hb_ot_shape_plan_t *plan HB_UNUS
 }
 
 static OT::SubstLookup *
-arabic_fallback_synthesize_lookup_ligature (const hb_ot_shape_plan_t *plan HB_UNUSED,
-					    hb_font_t *font)
+arabic_fallback_synthesize_lookup_ligature (hb_font_t *font)
 {
   OT::GlyphID first_glyphs[ARRAY_LENGTH_CONST (ligature_table)];
   unsigned int first_glyphs_indirection[ARRAY_LENGTH_CONST (ligature_table)];
@@ -183,26 +181,96 @@ arabic_fallback_synthesize_lookup_ligature (const hb_ot_shape_plan_t *plan HB_UN
 }
 
 static OT::SubstLookup *
-arabic_fallback_synthesize_lookup (const hb_ot_shape_plan_t *plan,
-				   hb_font_t *font,
+arabic_fallback_synthesize_lookup (hb_font_t *font,
 				   unsigned int feature_index)
 {
   if (feature_index < 4)
-    return arabic_fallback_synthesize_lookup_single (plan, font, feature_index);
+    return arabic_fallback_synthesize_lookup_single (font, feature_index);
   else
-    return arabic_fallback_synthesize_lookup_ligature (plan, font);
+    return arabic_fallback_synthesize_lookup_ligature (font);
 }
 
-struct arabic_fallback_plan_t
+/* The synthesized lookups only depend on the cmap of the face, so they are
+ * built once per face and shared by all the plans shaping with it. */
+struct arabic_fallback_lookups_t
 {
   ASSERT_POD ();
 
-  hb_mask_t mask_array[ARABIC_NUM_FALLBACK_FEATURES];
   OT::SubstLookup *lookup_array[ARABIC_NUM_FALLBACK_FEATURES];
   hb_ot_layout_lookup_accelerator_t accel_array[ARABIC_NUM_FALLBACK_FEATURES];
 };
 
-static const arabic_fallback_plan_t arabic_fallback_plan_nil = {};
+static const arabic_fallback_lookups_t arabic_fallback_lookups_nil = {};
+
+static arabic_fallback_lookups_t *
+arabic_fallback_lookups_create (hb_font_t *font)
+{
+  arabic_fallback_lookups_t *lookups = (arabic_fallback_lookups_t *) calloc (1, sizeof (arabic_fallback_lookups_t));
+  if (unlikely (!lookups))
+    return NULL;
+
+  for (unsigned int i = 0; i < ARABIC_NUM_FALLBACK_FEATURES; i++)
+  {
+    lookups->lookup_array[i] = arabic_fallback_synthesize_lookup (font, i);
+    if (lookups->lookup_array[i])
+      lookups->accel_array[i].init (*lookups->lookup_array[i]);
+  }
+
+  return lookups;
+}
+
+static void
+arabic_fallback_lookups_destroy (arabic_fallback_lookups_t *lookups)
+{
+  for (unsigned int i = 0; i < ARABIC_NUM_FALLBACK_FEATURES; i++)
+    if (lookups->lookup_array[i])
+    {
+      lookups->accel_array[i].fini (lookups->lookup_array[i]);
+      free (lookups->lookup_array[i]);
+    }
+
+  free (lookups);
+}
+
+static hb_user_data_key_t arabic_fallback_lookups_user_data_key;
+
+static const arabic_fallback_lookups_t *
+arabic_fallback_lookups_get (hb_font_t *font)
+{
+  hb_face_t *face = font->face;
+
+  arabic_fallback_lookups_t *lookups = (arabic_fallback_lookups_t *) hb_face_get_user_data (face, &arabic_fallback_lookups_user_data_key);
+
+  if (unlikely (!lookups))
+  {
+    lookups = arabic_fallback_lookups_create (font);
+    if (unlikely (!lookups))
+      return &arabic_fallback_lookups_nil;
+
+    if (!hb_face_set_user_data (face, &arabic_fallback_lookups_user_data_key,
+				lookups, (hb_destroy_func_t) arabic_fallback_lookups_destroy,
+				false)) {
+      /* Someone else was faster, or the face is inert, or out of memory:
+       * use the lookups published meanwhile if any, else the nil ones. */
+      arabic_fallback_lookups_destroy (lookups);
+      lookups = (arabic_fallback_lookups_t *) hb_face_get_user_data (face, &arabic_fallback_lookups_user_data_key);
+      if (unlikely (!lookups))
+	return &arabic_fallback_lookups_nil;
+    }
+  }
+
+  return lookups;
+}
+
+struct arabic_fallback_plan_t
+{
+  ASSERT_POD ();
+
+  hb_mask_t mask_array[ARABIC_NUM_FALLBACK_FEATURES];
+  const arabic_fallback_lookups_t *lookups; /* Owned by the face. */
+};
+
+static const arabic_fallback_plan_t arabic_fallback_plan_nil = {{0}, &arabic_fallback_lookups_nil};
 
 static arabic_fallback_plan_t *
 arabic_fallback_plan_create (const hb_ot_shape_plan_t *plan,
@@ -213,14 +281,8 @@ arabic_fallback_plan_create (const hb_ot_shape_plan_t *plan,
     return const_cast<arabic_fallback_plan_t *> (&arabic_fallback_plan_nil);
 
   for (unsigned int i = 0; i < ARABIC_NUM_FALLBACK_FEATURES; i++)
-  {
     fallback_plan->mask_array[i] = plan->map.get_1_mask (arabic_fallback_features[i]);
-    if (fallback_plan->mask_array[i]) {
-      fallback_plan->lookup_array[i] = arabic_fallback_synthesize_lookup (plan, font, i);
-      if (fallback_plan->lookup_array[i])
-	fallback_plan->accel_array[i].init (*fallback_plan->lookup_array[i]);
-    }
-  }
+  fallback_plan->lookups = arabic_fallback_lookups_get (font);
 
   return fallback_plan;
 }
@@ -231,13 +293,6 @@ arabic_fallback_plan_destroy (arabic_fallback_plan_t *fallback_plan)
   if (!fallback_plan || fallback_plan == &arabic_fallback_plan_nil)
     return;
 
-  for (unsigned int i = 0; i < ARABIC_NUM_FALLBACK_FEATURES; i++)
-    if (fallback_plan->lookup_array[i])
-    {
-      fallback_plan->accel_array[i].fini (fallback_plan->lookup_array[i]);
-      free (fallback_plan->lookup_array[i]);
-    }
-
   free (fallback_plan);
 }
 
@@ -246,15 +301,15 @@ arabic_fallback_plan_shape (arabic_fallback_plan_t *fallback_plan,
 			    hb_font_t *font,
 			    hb_buffer_t *buffer)
 {
+  const arabic_fallback_lookups_t *lookups = fallback_plan->lookups;
   OT::hb_apply_context_t c (0, font, buffer);
   for (unsigned int i = 0; i < ARABIC_NUM_FALLBACK_FEATURES; i++)
-    if (fallback_plan->lookup_array[i]) {
+    if (fallback_plan->mask_array[i] && lookups->lookup_array[i]) {
       c.set_lookup_mask (fallback_plan->mask_array[i]);
       hb_ot_layout_substitute_lookup (&c,
-				      *fallback_plan->lookup_array[i],
-				      fallback_plan->accel_array[i]);
+				      *lookups->lookup_array[i],
+				      lookups->accel_array[i]);
     }
 }
 
-
 #endif /* HB_OT_SHAPE_COMPLEX_ARABIC_FALLBACK_HH */
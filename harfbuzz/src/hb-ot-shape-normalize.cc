@@ -274,6 +274,38 @@ decompose_cluster (const hb_ot_shape_normalize_context_t *c, bool short_circuit,
 }
 
 
+/* Quick check: returns true, with glyph indices set, if none of the rounds
+ * below would change the buffer.  That is the case when there are no marks
+ * (hence no nonzero combining class and no variation selectors), every
+ * character is a cluster of its own, and the font supports each character
+ * as-is; without short-circuit they must also not decompose.  Almost all
+ * text is like that. */
+static bool
+quick_check (const hb_ot_shape_normalize_context_t *c, bool short_circuit)
+{
+  hb_buffer_t * const buffer = c->buffer;
+  hb_glyph_info_t * const info = buffer->info;
+  unsigned int count = buffer->len;
+
+  /* Only looks at the unicode props cached in the buffer. */
+  for (unsigned int i = 0; i < count; i++)
+    if (HB_UNICODE_GENERAL_CATEGORY_IS_MARK (_hb_glyph_info_get_general_category (&info[i])) ||
+	_hb_glyph_info_get_modified_combining_class (&info[i]) ||
+	(i + 1 < count && info[i].cluster == info[i + 1].cluster))
+      return false;
+
+  for (unsigned int i = 0; i < count; i++)
+  {
+    hb_codepoint_t a, b;
+    if ((!short_circuit && c->decompose (c, info[i].codepoint, &a, &b)) ||
+	!c->font->get_glyph (info[i].codepoint, 0, &info[i].glyph_index()))
+      return false;
+  }
+
+  return true;
+}
+
+
 static int
 compare_combining_class (const hb_glyph_info_t *pa, const hb_glyph_info_t *pb)
 {
@@ -305,6 +337,9 @@ _hb_ot_shape_normalize (const hb_ot_shape_plan_t *plan,
 		       mode != HB_OT_SHAPE_NORMALIZATION_MODE_COMPOSED_DIACRITICS_NO_SHORT_CIRCUIT;
   unsigned int count;
 
+  if (quick_check (&c, short_circuit))
+    return;
+
   /* We do a fairly straightforward yet custom normalization process in three
    * separate rounds: decompose, reorder, recompose (if desired).  Currently
    * this makes two buffer swaps.  We can make it faster by moving the last
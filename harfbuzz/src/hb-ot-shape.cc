@@ -697,5 +697,7 @@ hb_ot_shape_glyphs_closure (hb_font_t          *font,
       hb_ot_layout_lookup_substitute_closure (font->face, lookup_index, glyphs);
   } while (!copy.is_equal (glyphs));
 
+  copy.fini ();
+  lookups.fini ();
   hb_shape_plan_destroy (shape_plan);
 }
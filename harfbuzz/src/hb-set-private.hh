@@ -142,29 +142,172 @@ typedef hb_set_digest_combiner_t
  */
 
 
-/* TODO Make this faster and memmory efficient. */
+/* Sparse set: the elements are stored in 512-bit pages, allocated only for
+ * the ranges of the codepoint space that are used, and found through a map
+ * sorted by page number.  Pages emptied by del() or intersect() are kept
+ * until the next clear(). */
 
 struct hb_set_t
 {
+  struct page_map_t
+  {
+    uint32_t major; /* Page number: first element of the page / PAGE_BITS. */
+    uint32_t index; /* Into pages. */
+  };
+
+  struct page_t
+  {
+    inline void init0 (void) { memset (&v, 0, sizeof (v)); }
+    inline void init1 (void) { memset (&v, 0xff, sizeof (v)); }
+
+    inline unsigned int len (void) const { return ARRAY_LENGTH (v); }
+
+    inline bool is_empty (void) const
+    {
+      for (unsigned int i = 0; i < len (); i++)
+	if (v[i])
+	  return false;
+      return true;
+    }
+
+    inline void add (hb_codepoint_t g) { elt (g) |= mask (g); }
+    inline void del (hb_codepoint_t g) { elt (g) &= ~mask (g); }
+    inline bool has (hb_codepoint_t g) const { return !!(elt (g) & mask (g)); }
+
+    /* a and b must be in this page. */
+    inline void add_range (hb_codepoint_t a, hb_codepoint_t b)
+    {
+      elt_t *la = &elt (a);
+      elt_t *lb = &elt (b);
+      if (la == lb)
+	*la |= (mask (b) << 1) - mask (a);
+      else
+      {
+	*la++ |= ~(mask (a) - 1);
+	for (; la < lb; la++)
+	  *la = (elt_t) -1;
+	*lb |= (mask (b) << 1) - 1;
+      }
+    }
+    inline void del_range (hb_codepoint_t a, hb_codepoint_t b)
+    {
+      elt_t *la = &elt (a);
+      elt_t *lb = &elt (b);
+      if (la == lb)
+	*la &= ~((mask (b) << 1) - mask (a));
+      else
+      {
+	*la++ &= mask (a) - 1;
+	for (; la < lb; la++)
+	  *la = 0;
+	*lb &= ~((mask (b) << 1) - 1);
+      }
+    }
+
+    inline bool is_equal (const page_t *other) const
+    {
+      return 0 == memcmp (&v, &other->v, sizeof (v));
+    }
+
+    inline void set (const page_t *other) { memcpy (&v, &other->v, sizeof (v)); }
+    inline void union_ (const page_t *other)
+    {
+      for (unsigned int i = 0; i < len (); i++)
+	v[i] |= other->v[i];
+    }
+    inline void intersect (const page_t *other)
+    {
+      for (unsigned int i = 0; i < len (); i++)
+	v[i] &= other->v[i];
+    }
+    inline void subtract (const page_t *other)
+    {
+      for (unsigned int i = 0; i < len (); i++)
+	v[i] &= ~other->v[i];
+    }
+    inline void symmetric_difference (const page_t *other)
+    {
+      for (unsigned int i = 0; i < len (); i++)
+	v[i] ^= other->v[i];
+    }
+    inline void invert (void)
+    {
+      for (unsigned int i = 0; i < len (); i++)
+	v[i] = ~v[i];
+    }
+
+    inline unsigned int get_population (void) const
+    {
+      unsigned int count = 0;
+      for (unsigned int i = 0; i < len (); i++)
+	count += _hb_popcount32 (v[i]);
+      return count;
+    }
+
+    /* Moves *i, an index into the page, to the first element at or after it. */
+    inline bool next (unsigned int *i) const
+    {
+      unsigned int j = *i / ELT_BITS;
+      elt_t bits = v[j] & ~(mask (*i) - 1);
+      while (!bits)
+      {
+	if (++j == len ())
+	  return false;
+	bits = v[j];
+      }
+      *i = j * ELT_BITS + _hb_ctz (bits);
+      return true;
+    }
+    inline unsigned int get_min (void) const
+    {
+      unsigned int i = 0;
+      return next (&i) ? i : INVALID;
+    }
+    inline unsigned int get_max (void) const
+    {
+      for (unsigned int j = len (); j; j--)
+	if (v[j - 1])
+	  return (j - 1) * ELT_BITS + _hb_bit_storage (v[j - 1]) - 1;
+      return INVALID;
+    }
+
+    typedef uint32_t elt_t;
+    static const unsigned int ELT_BITS = sizeof (elt_t) * 8;
+    static const unsigned int ELT_MASK = ELT_BITS - 1;
+
+    elt_t &elt (hb_codepoint_t g) { return v[(g & PAGE_MASK) / ELT_BITS]; }
+    elt_t elt (hb_codepoint_t g) const { return v[(g & PAGE_MASK) / ELT_BITS]; }
+    static inline elt_t mask (hb_codepoint_t g) { return elt_t (1) << (g & ELT_MASK); }
+
+    elt_t v[512 / ELT_BITS];
+  };
+
   hb_object_header_t header;
   ASSERT_POD ();
   bool in_error;
+  hb_prealloced_array_t<page_map_t, 8> page_map; /* Sorted by major. */
+  hb_prealloced_array_t<page_t, 1> pages;
 
   inline void init (void) {
     header.init ();
-    clear ();
+    in_error = false;
+    page_map.init ();
+    pages.init ();
   }
   inline void fini (void) {
+    page_map.finish ();
+    pages.finish ();
   }
   inline void clear (void) {
     if (unlikely (hb_object_is_inert (this)))
       return;
     in_error = false;
-    memset (elts, 0, sizeof elts);
+    page_map.shrink (0);
+    pages.shrink (0);
   }
   inline bool is_empty (void) const {
-    for (unsigned int i = 0; i < ARRAY_LENGTH (elts); i++)
-      if (elts[i])
+    for (unsigned int i = 0; i < pages.len; i++)
+      if (!pages[i].is_empty ())
         return false;
     return true;
   }
@@ -172,105 +315,172 @@ struct hb_set_t
   {
     if (unlikely (in_error)) return;
     if (unlikely (g == INVALID)) return;
-    if (unlikely (g > MAX_G)) return;
-    elt (g) |= mask (g);
+    page_t *page = page_for_insert (g);
+    if (unlikely (!page)) return;
+    page->add (g);
   }
   inline void add_range (hb_codepoint_t a, hb_codepoint_t b)
   {
     if (unlikely (in_error)) return;
-    /* TODO Speedup */
-    for (unsigned int i = a; i < b + 1; i++)
-      add (i);
+    if (unlikely (a > b || b == INVALID)) return;
+    for (unsigned int m = get_major (a); m <= get_major (b); m++)
+    {
+      page_t *page = page_for_insert (m * PAGE_BITS);
+      if (unlikely (!page)) return;
+      page->add_range (MAX (a, m * PAGE_BITS), MIN (b, m * PAGE_BITS + PAGE_MASK));
+    }
   }
   inline void del (hb_codepoint_t g)
   {
     if (unlikely (in_error)) return;
-    if (unlikely (g > MAX_G)) return;
-    elt (g) &= ~mask (g);
+    page_t *page = page_for (g);
+    if (!page) return;
+    page->del (g);
   }
   inline void del_range (hb_codepoint_t a, hb_codepoint_t b)
   {
     if (unlikely (in_error)) return;
-    /* TODO Speedup */
-    for (unsigned int i = a; i < b + 1; i++)
-      del (i);
+    if (unlikely (a > b || b == INVALID)) return;
+    unsigned int i;
+    find_page (get_major (a), &i);
+    for (; i < page_map.len && page_map[i].major <= get_major (b); i++)
+    {
+      unsigned int m = page_map[i].major;
+      pages[page_map[i].index].del_range (MAX (a, m * PAGE_BITS), MIN (b, m * PAGE_BITS + PAGE_MASK));
+    }
   }
   inline bool has (hb_codepoint_t g) const
   {
-    if (unlikely (g > MAX_G)) return false;
-    return !!(elt (g) & mask (g));
+    const page_t *page = page_for (g);
+    return page && page->has (g);
   }
   inline bool intersects (hb_codepoint_t first,
 			  hb_codepoint_t last) const
   {
-    if (unlikely (first > MAX_G)) return false;
-    if (unlikely (last  > MAX_G)) last = MAX_G;
-    unsigned int end = last + 1;
-    for (hb_codepoint_t i = first; i < end; i++)
-      if (has (i))
-        return true;
-    return false;
+    hb_codepoint_t i = first - 1; /* INVALID for first == 0, which next() starts from. */
+    return next (&i) && i <= last;
   }
   inline bool is_equal (const hb_set_t *other) const
   {
-    for (unsigned int i = 0; i < ELTS; i++)
-      if (elts[i] != other->elts[i])
+    unsigned int a = 0, b = 0;
+    while (a < page_map.len && b < other->page_map.len)
+    {
+      const page_t &pa = page_at (a);
+      const page_t &pb = other->page_at (b);
+      if (pa.is_empty ()) { a++; continue; }
+      if (pb.is_empty ()) { b++; continue; }
+      if (page_map[a].major != other->page_map[b].major || !pa.is_equal (&pb))
+        return false;
+      a++;
+      b++;
+    }
+    for (; a < page_map.len; a++)
+      if (!page_at (a).is_empty ())
+        return false;
+    for (; b < other->page_map.len; b++)
+      if (!other->page_at (b).is_empty ())
         return false;
     return true;
   }
   inline void set (const hb_set_t *other)
   {
     if (unlikely (in_error)) return;
-    for (unsigned int i = 0; i < ELTS; i++)
-      elts[i] = other->elts[i];
+    page_map.shrink (0);
+    pages.shrink (0);
+    for (unsigned int i = 0; i < other->page_map.len; i++)
+    {
+      page_map_t *map = page_map.push ();
+      page_t *page = pages.push ();
+      if (unlikely (!map || !page))
+      {
+        in_error = true;
+        return;
+      }
+      map->major = other->page_map[i].major;
+      map->index = i;
+      page->set (&other->page_at (i));
+    }
   }
   inline void union_ (const hb_set_t *other)
   {
     if (unlikely (in_error)) return;
-    for (unsigned int i = 0; i < ELTS; i++)
-      elts[i] |= other->elts[i];
+    for (unsigned int i = 0; i < other->page_map.len; i++)
+    {
+      const page_t &other_page = other->page_at (i);
+      if (other_page.is_empty ()) continue;
+      page_t *page = page_for_insert (other->page_map[i].major * PAGE_BITS);
+      if (unlikely (!page)) return;
+      page->union_ (&other_page);
+    }
   }
   inline void intersect (const hb_set_t *other)
   {
     if (unlikely (in_error)) return;
-    for (unsigned int i = 0; i < ELTS; i++)
-      elts[i] &= other->elts[i];
+    for (unsigned int i = 0; i < page_map.len; i++)
+    {
+      const page_t *other_page = other->page_for (page_map[i].major * PAGE_BITS);
+      if (other_page)
+        pages[page_map[i].index].intersect (other_page);
+      else
+        pages[page_map[i].index].init0 ();
+    }
   }
   inline void subtract (const hb_set_t *other)
   {
     if (unlikely (in_error)) return;
-    for (unsigned int i = 0; i < ELTS; i++)
-      elts[i] &= ~other->elts[i];
+    for (unsigned int i = 0; i < page_map.len; i++)
+    {
+      const page_t *other_page = other->page_for (page_map[i].major * PAGE_BITS);
+      if (other_page)
+        pages[page_map[i].index].subtract (other_page);
+    }
   }
   inline void symmetric_difference (const hb_set_t *other)
   {
     if (unlikely (in_error)) return;
-    for (unsigned int i = 0; i < ELTS; i++)
-      elts[i] ^= other->elts[i];
+    for (unsigned int i = 0; i < other->page_map.len; i++)
+    {
+      const page_t &other_page = other->page_at (i);
+      if (other_page.is_empty ()) continue;
+      page_t *page = page_for_insert (other->page_map[i].major * PAGE_BITS);
+      if (unlikely (!page)) return;
+      page->symmetric_difference (&other_page);
+    }
   }
+  /* Inverts the set within the 16-bit glyph space; larger elements are kept. */
   inline void invert (void)
   {
     if (unlikely (in_error)) return;
-    for (unsigned int i = 0; i < ELTS; i++)
-      elts[i] = ~elts[i];
+    for (unsigned int m = 0; m <= get_major (0xFFFFu); m++)
+    {
+      page_t *page = page_for_insert (m * PAGE_BITS);
+      if (unlikely (!page)) return;
+      page->invert ();
+    }
   }
   inline bool next (hb_codepoint_t *codepoint) const
   {
-    if (unlikely (*codepoint == INVALID)) {
-      hb_codepoint_t i = get_min ();
-      if (i != INVALID) {
-        *codepoint = i;
-	return true;
-      } else {
-	*codepoint = INVALID;
-        return false;
+    hb_codepoint_t g = *codepoint + 1; /* Wraps INVALID to zero. */
+    unsigned int i;
+    if (find_page (get_major (g), &i))
+    {
+      unsigned int j = g & PAGE_MASK;
+      if (page_at (i).next (&j))
+      {
+        *codepoint = page_map[i].major * PAGE_BITS + j;
+        return true;
       }
+      i++;
     }
-    for (hb_codepoint_t i = *codepoint + 1; i < MAX_G + 1; i++)
-      if (has (i)) {
-        *codepoint = i;
-	return true;
+    for (; i < page_map.len; i++)
+    {
+      unsigned int j = 0;
+      if (page_at (i).next (&j))
+      {
+        *codepoint = page_map[i].major * PAGE_BITS + j;
+        return true;
       }
+    }
     *codepoint = INVALID;
     return false;
   }
@@ -295,45 +505,90 @@ struct hb_set_t
   inline unsigned int get_population (void) const
   {
     unsigned int count = 0;
-    for (unsigned int i = 0; i < ELTS; i++)
-      count += _hb_popcount32 (elts[i]);
+    for (unsigned int i = 0; i < pages.len; i++)
+      count += pages[i].get_population ();
     return count;
   }
   inline hb_codepoint_t get_min (void) const
   {
-    for (unsigned int i = 0; i < ELTS; i++)
-      if (elts[i])
-	for (unsigned int j = 0; j < BITS; j++)
-	  if (elts[i] & (1 << j))
-	    return i * BITS + j;
+    for (unsigned int i = 0; i < page_map.len; i++)
+    {
+      unsigned int j = page_at (i).get_min ();
+      if (j != INVALID)
+	return page_map[i].major * PAGE_BITS + j;
+    }
     return INVALID;
   }
   inline hb_codepoint_t get_max (void) const
   {
-    for (unsigned int i = ELTS; i; i--)
-      if (elts[i - 1])
-	for (unsigned int j = BITS; j; j--)
-	  if (elts[i - 1] & (1 << (j - 1)))
-	    return (i - 1) * BITS + (j - 1);
+    for (unsigned int i = page_map.len; i; i--)
+    {
+      unsigned int j = page_at (i - 1).get_max ();
+      if (j != INVALID)
+	return page_map[i - 1].major * PAGE_BITS + j;
+    }
     return INVALID;
   }
 
-  typedef uint32_t elt_t;
-  static const unsigned int MAX_G = 65536 - 1; /* XXX Fix this... */
-  static const unsigned int SHIFT = 5;
-  static const unsigned int BITS = (1 << SHIFT);
-  static const unsigned int MASK = BITS - 1;
-  static const unsigned int ELTS = (MAX_G + 1 + (BITS - 1)) / BITS;
+  static const unsigned int PAGE_BITS = 512;
+  static const unsigned int PAGE_MASK = PAGE_BITS - 1;
   static  const hb_codepoint_t INVALID = HB_SET_VALUE_INVALID;
 
-  elt_t &elt (hb_codepoint_t g) { return elts[g >> SHIFT]; }
-  elt_t elt (hb_codepoint_t g) const { return elts[g >> SHIFT]; }
-  elt_t mask (hb_codepoint_t g) const { return elt_t (1) << (g & MASK); }
+  static inline unsigned int get_major (hb_codepoint_t g) { return g / PAGE_BITS; }
+
+  const page_t &page_at (unsigned int i) const { return pages[page_map[i].index]; }
 
-  elt_t elts[ELTS]; /* XXX 8kb */
+  /* Sets *i to the index of major in page_map, or of where it would be inserted. */
+  inline bool find_page (unsigned int major, unsigned int *i) const
+  {
+    unsigned int lo = 0, hi = page_map.len;
+    while (lo < hi)
+    {
+      unsigned int mid = (lo + hi) / 2;
+      if (page_map[mid].major < major)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    *i = lo;
+    return lo < page_map.len && page_map[lo].major == major;
+  }
+  const page_t *page_for (hb_codepoint_t g) const
+  {
+    unsigned int i;
+    return find_page (get_major (g), &i) ? &page_at (i) : NULL;
+  }
+  page_t *page_for (hb_codepoint_t g)
+  {
+    unsigned int i;
+    return find_page (get_major (g), &i) ? &pages[page_map[i].index] : NULL;
+  }
+  page_t *page_for_insert (hb_codepoint_t g)
+  {
+    unsigned int i;
+    if (find_page (get_major (g), &i))
+      return &pages[page_map[i].index];
+
+    page_t *page = pages.push ();
+    if (unlikely (!page))
+    {
+      in_error = true;
+      return NULL;
+    }
+    if (unlikely (!page_map.push ()))
+    {
+      pages.pop ();
+      in_error = true;
+      return NULL;
+    }
+    page->init0 ();
+    memmove (&page_map[i + 1], &page_map[i], (page_map.len - 1 - i) * sizeof (page_map[0]));
+    page_map[i].major = get_major (g);
+    page_map[i].index = pages.len - 1;
+    return page;
+  }
 
-  ASSERT_STATIC (sizeof (elt_t) * 8 == BITS);
-  ASSERT_STATIC (sizeof (elt_t) * 8 * ELTS > MAX_G);
+  ASSERT_STATIC (sizeof (page_t) * 8 == PAGE_BITS);
 };
 
 
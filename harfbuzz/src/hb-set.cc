@@ -64,7 +64,8 @@ hb_set_get_empty (void)
     HB_OBJECT_HEADER_STATIC,
     true, /* in_error */
 
-    {0} /* elts */
+    {0, 0, NULL, {}}, /* page_map */
+    {0, 0, NULL, {}}  /* pages */
   };
 
   return const_cast<hb_set_t *> (&_hb_set_nil);
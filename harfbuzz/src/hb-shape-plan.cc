@@ -304,15 +304,6 @@ hb_shape_plan_execute (hb_shape_plan_t    *shape_plan,
  * caching
  */
 
-#if 0
-static unsigned int
-hb_shape_plan_hash (const hb_shape_plan_t *shape_plan)
-{
-  return hb_segment_properties_hash (&shape_plan->props) +
-	 shape_plan->default_shaper_list ? 0 : (intptr_t) shape_plan->shaper_func;
-}
-#endif
-
 /* User-feature caching is currently somewhat dumb:
  * it only finds matches where the feature array is identical,
  * not cases where the feature lists would be compatible for plan purposes
@@ -340,6 +331,21 @@ hb_shape_plan_user_features_match (const hb_shape_plan_t          *shape_plan,
   return true;
 }
 
+/* The shaper is not part of the hash, as a plan made with the default
+ * shaper list also matches proposals explicitly asking for its shaper. */
+static unsigned int
+hb_shape_plan_proposal_hash (const hb_shape_plan_proposal_t *proposal)
+{
+  unsigned int hash = hb_segment_properties_hash (&proposal->props);
+  for (unsigned int i = 0, n = proposal->num_user_features; i < n; i++)
+    hash = hash * 31 + proposal->user_features[i].tag +
+	   proposal->user_features[i].value * 7 +
+	   proposal->user_features[i].start * 11 +
+	   proposal->user_features[i].end * 13;
+  /* Fibonacci hashing; the language pointer has its low bits zeroed. */
+  return hash * 2654435761u;
+}
+
 static hb_bool_t
 hb_shape_plan_matches (const hb_shape_plan_t          *shape_plan,
 		       const hb_shape_plan_proposal_t *proposal)
@@ -415,10 +421,14 @@ hb_shape_plan_create_cached (hb_face_t                     *face,
   }
 
 
+  unsigned int hash = hb_shape_plan_proposal_hash (&proposal);
+  /* Use the high bits of the hash, which are the well mixed ones. */
+  hb_face_t::plan_node_t **bucket = &face->shape_plans[(hash >> 16) & (ARRAY_LENGTH (face->shape_plans) - 1)];
+
 retry:
-  hb_face_t::plan_node_t *cached_plan_nodes = (hb_face_t::plan_node_t *) hb_atomic_ptr_get (&face->shape_plans);
+  hb_face_t::plan_node_t *cached_plan_nodes = (hb_face_t::plan_node_t *) hb_atomic_ptr_get (bucket);
   for (hb_face_t::plan_node_t *node = cached_plan_nodes; node; node = node->next)
-    if (hb_shape_plan_matches (node->shape_plan, &proposal))
+    if (node->hash == hash && hb_shape_plan_matches (node->shape_plan, &proposal))
       return hb_shape_plan_reference (node->shape_plan);
 
   /* Not found. */
@@ -435,9 +445,10 @@ retry:
     return shape_plan;
 
   node->shape_plan = shape_plan;
+  node->hash = hash;
   node->next = cached_plan_nodes;
 
-  if (!hb_atomic_ptr_cmpexch (&face->shape_plans, cached_plan_nodes, node)) {
+  if (!hb_atomic_ptr_cmpexch (bucket, cached_plan_nodes, node)) {
     hb_shape_plan_destroy (shape_plan);
     free (node);
     goto retry;
@@ -20,6 +20,19 @@
 
 #include "ucdn.h"
 
+#include "hb-ucdn-table.hh"
+
+/* All the properties the callbacks below need, packed in a single record. */
+static inline uint32_t
+hb_ucdn_get_packed (hb_codepoint_t unicode)
+{
+    if (unlikely (unicode >= 0x110000))
+        return HB_UCDN_INVALID_RECORD;
+    unsigned int block = _hb_ucdn_block_index[unicode >> HB_UCDN_BLOCK_SHIFT];
+    unsigned int offset = unicode & ((1u << HB_UCDN_BLOCK_SHIFT) - 1);
+    return _hb_ucdn_packed_records[_hb_ucdn_record_index[(block << HB_UCDN_BLOCK_SHIFT) + offset]];
+}
+
 static const hb_script_t ucdn_script_translate[] =
 {
     HB_SCRIPT_COMMON,
@@ -131,36 +144,35 @@ static hb_unicode_combining_class_t
 hb_ucdn_combining_class(hb_unicode_funcs_t *ufuncs, hb_codepoint_t unicode,
 			void *user_data HB_UNUSED)
 {
-    return (hb_unicode_combining_class_t) ucdn_get_combining_class(unicode);
+    return (hb_unicode_combining_class_t) HB_UCDN_COMBINING_CLASS(hb_ucdn_get_packed(unicode));
 }
 
 static unsigned int
 hb_ucdn_eastasian_width(hb_unicode_funcs_t *ufuncs, hb_codepoint_t unicode,
 			void *user_data HB_UNUSED)
 {
-    int w = ucdn_get_east_asian_width(unicode);
-    return (w == UCDN_EAST_ASIAN_F || w == UCDN_EAST_ASIAN_W) ? 2 : 1;
+    return HB_UCDN_EASTASIAN_WIDE(hb_ucdn_get_packed(unicode)) ? 2 : 1;
 }
 
 static hb_unicode_general_category_t
 hb_ucdn_general_category(hb_unicode_funcs_t *ufuncs, hb_codepoint_t unicode,
 			 void *user_data HB_UNUSED)
 {
-    return (hb_unicode_general_category_t)ucdn_get_general_category(unicode);
+    return (hb_unicode_general_category_t)HB_UCDN_GENERAL_CATEGORY(hb_ucdn_get_packed(unicode));
 }
 
 static hb_codepoint_t
 hb_ucdn_mirroring(hb_unicode_funcs_t *ufuncs, hb_codepoint_t unicode,
 		  void *user_data HB_UNUSED)
 {
-    return ucdn_mirror(unicode);
+    return unicode + HB_UCDN_MIRRORING_DELTA(hb_ucdn_get_packed(unicode));
 }
 
 static hb_script_t
 hb_ucdn_script(hb_unicode_funcs_t *ufuncs, hb_codepoint_t unicode,
 	       void *user_data HB_UNUSED)
 {
-    return ucdn_script_translate[ucdn_get_script(unicode)];
+    return ucdn_script_translate[HB_UCDN_SCRIPT(hb_ucdn_get_packed(unicode))];
 }
 
 static hb_bool_t
@@ -29,6 +29,15 @@
 
 #include "hb-private.hh"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define HB_UTF_AVX2 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HB_UTF_SSE2 1
+#endif
+
 
 /* UTF-8 */
 
@@ -111,6 +120,42 @@ hb_utf_strlen (const uint8_t *text)
   return strlen ((const char *) text);
 }
 
+/* Length of the run of ASCII characters starting at text, which decode to
+ * themselves.  Tested 32 (AVX2), 16 (SSE2) or 8 bytes at a time, then the
+ * block holding the first non-ASCII byte is finished byte by byte. */
+static inline unsigned int
+hb_utf_ascii_length (const uint8_t *text,
+		     const uint8_t *end)
+{
+  const uint8_t *start = text;
+
+  if (*text >= 0x80)
+    return 0;
+
+#ifdef HB_UTF_AVX2
+  while (end - text >= 32 &&
+	 !_mm256_movemask_epi8 (_mm256_loadu_si256 ((const __m256i *) (const void *) text)))
+    text += 32;
+#endif
+#ifdef HB_UTF_SSE2
+  while (end - text >= 16 &&
+	 !_mm_movemask_epi8 (_mm_loadu_si128 ((const __m128i *) (const void *) text)))
+    text += 16;
+#endif
+  while (end - text >= 8)
+  {
+    uint64_t v;
+    memcpy (&v, text, sizeof (v));
+    if (v & 0x8080808080808080ULL)
+      break;
+    text += 8;
+  }
+  while (text < end && *text < 0x80)
+    text++;
+
+  return text - start;
+}
+
 
 /* UTF-16 */
 
@@ -171,6 +216,13 @@ hb_utf_strlen (const uint16_t *text)
   return l;
 }
 
+static inline unsigned int
+hb_utf_ascii_length (const uint16_t *text HB_UNUSED,
+		     const uint16_t *end HB_UNUSED)
+{
+  return 0;
+}
+
 
 /* UTF-32 */
 
@@ -200,5 +252,12 @@ hb_utf_strlen (const uint32_t *text)
   return l;
 }
 
+static inline unsigned int
+hb_utf_ascii_length (const uint32_t *text HB_UNUSED,
+		     const uint32_t *end HB_UNUSED)
+{
+  return 0;
+}
+
 
 #endif /* HB_UTF_PRIVATE_HH */
@@ -14,6 +14,7 @@
 #include <gltext/Text.h>
 
 #include <string>
+#include <vector>
 
 namespace gltext {
 
@@ -22,6 +23,66 @@ namespace gltext {
  */
 class FontImpl;
 
+/**
+ * @brief Text segment properties for which a HarfBuzz shaping plan is precompiled when a Font loads.
+ *
+ *  Shaping plans are otherwise built the first time a text with new properties is assembled,
+ * which can give a noticeable latency spike when a new language first appears on screen.
+ * Properties are given as strings, parsed by HarfBuzz, to keep the public API free of HarfBuzz types.
+ *
+ *  Font::assemble() guesses the script from the characters of the text, the direction from the script,
+ * and uses the language of the current locale unless told otherwise. An empty language or direction
+ * is guessed the same way, so a plan only needs the script of the texts to warm up, like {"Latn"} or {"Arab"}.
+ * An empty script only matches texts without any letter (digits, punctuation...).
+ */
+struct ShapingPlan {
+    std::string                 script;     ///< ISO 15924 script tag, like "Latn" or "Arab"
+    std::string                 language;   ///< BCP 47 language tag, like "en" or "ar" (default to the locale)
+    std::string                 direction;  ///< "ltr", "rtl", "ttb" or "btt" (default to the script direction)
+    std::vector<std::string>    features;   ///< OpenType features, like "kern", "-liga" or "ss01=1"
+};
+
+/**
+ * @brief Handle to a language, interned once so that texts can then be tagged with it at no parsing cost.
+ *
+ *  Parsing a language tag means looking it up in a process-wide table of the languages seen so far.
+ * A Language does it only once, when constructed, and can then be copied and given to Font::assemble() freely,
+ * from any thread. Handles stay valid until the process exits.
+ */
+class Language {
+public:
+    /**
+     * @brief Intern the given language tag.
+     *
+     * @param[in] aTag  BCP 47 language tag, like "en" or "ar" (case insensitive, '_' is the same as '-').
+     *                  An empty tag gives no language, so texts are shaped in the language of the current locale,
+     *                  as with Font::assemble(aCharacters).
+     */
+    explicit Language(const std::string& aTag);
+
+    /**
+     * @brief Get the canonical form of the language tag, like "en-us" for "en_US".
+     *
+     * @return Lowercase language tag, or an empty string for the default language.
+     */
+    const char* getTag() const;
+
+    /// Two handles are equal if their language tags are the same in their canonical form.
+    bool operator==(const Language& aOther) const {
+        return (mHandle == aOther.mHandle);
+    }
+    /// Two handles are different if their language tags differ in their canonical form.
+    bool operator!=(const Language& aOther) const {
+        return (mHandle != aOther.mHandle);
+    }
+
+private:
+    friend class Font;
+    friend class FontStack;
+
+    const void* mHandle;    ///< Interned HarfBuzz language (hb_language_t), kept opaque to the client application
+};
+
 /**
  * @brief Manage the Freetype rendering of a font, and cache the resulting glyphs.
  *
@@ -47,11 +108,48 @@ public:
      *  std::exception can be thrown in case of error during this process,
      * thus the new Font object will not be created, and any element will be cleaned accordingly.
      *
+     *  The shaping plans of the given list of text segment properties are also precompiled while the font loads.
+     *
      * @param[in] apPathFilename    Path to the OpenType font file to open with Freetype.
      * @param[in] aPixelSize        Vertical size of the font in pixel
      * @param[in] aCacheSize        Minimum number of characters to allocate into the cache (use a square value).
+     * @param[in] aShapingPlans     List of text segment properties for which to precompile the shaping plans.
+     */
+    Font(const char* apPathFilename, unsigned int aPixelSize = 16, unsigned int aCacheSize = 100,
+         const std::vector<ShapingPlan>& aShapingPlans = std::vector<ShapingPlan>());
+
+    /**
+     * @brief Ask Freetype to read a Font from memory without copying it, and initialize it with the given size
+     *
+     *  Same as the constructor above, for a font file content already in memory, typically a font embedded
+     * in the application binary with the gltext_embed_fonts() CMake function, so that no file is read at runtime.
+     *
+     * @warning The data is read in place: it must remain valid as long as this Font, or any Text, uses it.
+     *
+     * @param[in] apData            Content of the OpenType font file.
+     * @param[in] aSize             Size of the content in bytes.
+     * @param[in] aPixelSize        Vertical size of the font in pixel
+     * @param[in] aCacheSize        Minimum number of characters to allocate into the cache (use a square value).
+     * @param[in] aShapingPlans     List of text segment properties for which to precompile the shaping plans.
      */
-    Font(const char* apPathFilename, unsigned int aPixelSize = 16, unsigned int aCacheSize = 100);
+    Font(const unsigned char* apData, size_t aSize, unsigned int aPixelSize = 16, unsigned int aCacheSize = 100,
+         const std::vector<ShapingPlan>& aShapingPlans = std::vector<ShapingPlan>());
+
+    /**
+     * @brief Load a prebuilt bitmap font in the AngelCode BMFont format, without Freetype nor HarfBuzz.
+     *
+     *  The descriptor can be in the text or in the binary format, and its page images must be TGA files
+     * (8 bits grayscale, or 32 bits with the glyphs in the alpha channel). All the glyphs are loaded at once
+     * into the cache texture, so cache() is not needed. Texts are laid out one glyph after the other, with the kerning
+     * pairs of the descriptor: there is no complex script shaping, nor any ligature.
+     *
+     * @param[in] apPathFilename    Path to the BMFont descriptor (.fnt) file, the page images being next to it.
+     *
+     * @return The bitmap Font, used as any other Font.
+     *
+     * @throw a gltext::Exception if the descriptor or a page image cannot be loaded.
+     */
+    static Font loadBMFont(const char* apPathFilename);
 
     /**
      * @brief Cleanup all Freetype and OpenGL ressources when the last reference is destroyed.
@@ -82,9 +180,11 @@ public:
      *
      * @warning Throws if any characters is missing from cache.
      *
-     *  An OpenGL Vertex Array Object (VAO) is created and initialized with states needed to draw the text.
-     * An OpenGL Vertex Buffer Object (VBO) is also created to contain glyphs vertex position and texture coordinates.
-     * An OpenGL Index Buffer Object (IBO) is created to index the glyphs vertices to be rendered.
+     *  The glyphs vertex position and texture coordinates are loaded into a slice of a large OpenGL Vertex Buffer
+     * Object (VBO) shared with other texts, and drawn with the Vertex Array Object (VAO) of this buffer
+     * (see Text::compact()). Only texts longer than 16384 glyphs get their own VAO and VBO.
+     * The glyphs vertices are indexed by an OpenGL Index Buffer Object (IBO) shared by all texts,
+     * with 32 bits indices for texts longer than 16384 glyphs.
      * Those internal data are encapsulated and reference-counted into the returned Text object.
      *
      * @param[in] aCharacters   UTF-8 encoded string of characters to pre-render and add to the cache.
@@ -93,6 +193,55 @@ public:
      */
     Text assemble(const std::string& aCharacters) const;
 
+    /**
+     * @brief Assemble data from cached glyphs to represent the given string of characters in the given language.
+     *
+     *  Same as assemble(), but the text is shaped according to the rules of the given language
+     * (localized forms, language specific ligatures...) instead of the one of the current locale.
+     *
+     * @warning Throws if any characters is missing from cache.
+     *
+     * @param[in] aCharacters   UTF-8 encoded string of characters to pre-render and add to the cache.
+     * @param[in] aLanguage     Language of the text, interned beforehand.
+     *
+     * @return Encapsulation of the constant text rendered with Freetype, ready to be drawn with OpenGL.
+     */
+    Text assemble(const std::string& aCharacters, const Language& aLanguage) const;
+
+    /**
+     * @brief Assemble data from cached glyphs to represent the given string of characters, as one instance per glyph.
+     *
+     *  Same as assemble(), but instead of the four vertices of its quad and their six indices, each glyph is stored
+     * as one compact record (its screen and texture rectangles) expanded into a quad by the vertex shader,
+     * and drawn with a single instanced draw call. This divides the vertex memory and the upload bandwidth
+     * of large texts by more than two, and no Index Buffer Object is used.
+     *
+     * @warning Throws if any characters is missing from cache.
+     *
+     * @param[in] aCharacters   UTF-8 encoded string of characters to pre-render and add to the cache.
+     *
+     * @return Encapsulation of the constant text rendered with Freetype, ready to be drawn with OpenGL.
+     */
+    Text assembleInstanced(const std::string& aCharacters) const;
+
+    /**
+     * @brief Assemble data from cached glyphs for many strings at once, and put each of them on a VAO.
+     *
+     *  Same as calling assemble() on each string, but the text shaping and the building of vertex data
+     * are spread across worker threads (one per core), each one using its own HarfBuzz font on the shared face.
+     * All OpenGL objects are then created and loaded in a single pass on the calling thread,
+     * which must thus be the one owning the OpenGL context, as for assemble().
+     *
+     * This method require cache to be fully loaded beforehand, which guaranty speed and multithread safety.
+     *
+     * @warning Throws if any characters is missing from cache, in which case no Text is returned.
+     *
+     * @param[in] aStrings  List of UTF-8 encoded strings of characters to assemble.
+     *
+     * @return List of the constant texts rendered with Freetype, in the same order as the provided strings.
+     */
+    std::vector<Text> assembleBatch(const std::vector<std::string>& aStrings) const;
+
     /**
      * @brief Draw the cache texture for debug purpose.
      *
@@ -104,6 +253,15 @@ public:
     void drawCache(float aX, float aY, float aW, float aH) const;
 
 private:
+    friend class FontStack;
+
+    /**
+     * @brief Give a new reference to an already loaded Font implementation.
+     *
+     * @param[in] aImplPtr  Shared pointer to the Private Implementation of the Font.
+     */
+    explicit Font(const std::shared_ptr<FontImpl>& aImplPtr);
+
     /**
      * @brief Private Implementation of the Freetype / HarfBuzz Font rendering
      *
@@ -0,0 +1,122 @@
+/**
+ * @file    FontStack.h
+ * @brief   Ordered list of fonts, each character of a text being rendered with the first font supporting it.
+ *
+ * Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <memory>   // for std::shared_ptr
+
+#include <gltext/Font.h>
+#include <gltext/Text.h>
+
+#include <string>
+#include <vector>
+
+namespace gltext {
+
+/**
+ * @brief Private Implementation of the font fallback chain
+ */
+class FontStackImpl;
+
+/**
+ * @brief Ordered list of fonts, each character of a text being rendered with the first font supporting it.
+ *
+ *  A character missing from a font is otherwise rendered as its .notdef glyph (usually an empty box).
+ * When the FontStack is created, an index of the first font supporting each character is built from the character
+ * maps of the fonts, so that picking the font of a character then costs a single lookup, whatever the number of fonts.
+ *  Texts are split into runs of consecutive characters using the same font, each run being shaped by its own font.
+ * Combining marks and joiners stay with the font of their base character when this font supports them.
+ *  Runs are laid out from left to right: consecutive right-to-left runs (Arabic, Hebrew...) are placed from the last
+ * one to the first one, so that a right-to-left text using several fonts reads in the right order. This is not a full
+ * implementation of the Unicode Bidirectional Algorithm: the line itself is always laid out from left to right.
+ *
+ *  As for Font, the FontStack public interface must never be used from multiple threads simultaneously.
+ *
+ *  Default Copy Constructor and Assignment Operator only copy the shared pointeur,
+ * which give a new reference to the FontStack instance.
+ */
+class FontStack {
+public:
+    /// Value returned by getFontIndex() for a character supported by none of the fonts.
+    static const size_t NOT_FOUND = static_cast<size_t>(-1);
+
+    /**
+     * @brief Build the index of the characters supported by each of the given fonts.
+     *
+     * @param[in] aFonts    Ordered list of fonts, from the preferred to the last resort one (at least one,
+     *                      and at most 255).
+     *
+     * @throw a gltext::Exception if the list is empty, or has more than 255 fonts.
+     */
+    explicit FontStack(const std::vector<Font>& aFonts);
+
+    /**
+     * @brief Release the references to the fonts.
+     */
+    ~FontStack();
+
+    // NOTE : see #FontStack class header about Copy & Assignment
+
+    /**
+     * @brief Get the index of the first font supporting the given character.
+     *
+     * @param[in] aCodepoint    Unicode character codepoint.
+     *
+     * @return Index of the font in the list given to the constructor, or NOT_FOUND.
+     */
+    size_t getFontIndex(unsigned int aCodepoint) const;
+
+    /**
+     * @brief Pre-render and cache the glyphs representing the given characters, each one into the font supporting it.
+     *
+     * @see Font::cache() for detailed explanation
+     *
+     * @param[in] aCharacters   UTF-8 encoded string of characters to pre-render and add to the caches.
+     *
+     * @return The highest cache usage of the fonts, in the range [0.0f; 1.0f]
+     */
+    float cache(const std::string& aCharacters);
+
+    /**
+     * @brief Assemble data from cached glyphs to represent the given string of characters, one Text per font run.
+     *
+     *  Each Text uses the cache texture of its font. The glyphs of each run are positioned after the ones
+     * of the runs on its left (in visual order), so that all the Texts drawn at the same position give the whole
+     * line of text.
+     *
+     * @warning Throws if any characters is missing from cache.
+     *
+     * @param[in] aCharacters   UTF-8 encoded string of characters to assemble.
+     *
+     * @return Encapsulation of the text of each run, in logical order, ready to be drawn with OpenGL.
+     */
+    std::vector<Text> assemble(const std::string& aCharacters) const;
+
+    /**
+     * @brief Assemble data from cached glyphs to represent the given string of characters in the given language.
+     *
+     * @see assemble() and Font::assemble() for detailed explanation
+     *
+     * @warning Throws if any characters is missing from cache.
+     *
+     * @param[in] aCharacters   UTF-8 encoded string of characters to assemble.
+     * @param[in] aLanguage     Language of the text, interned beforehand.
+     *
+     * @return Encapsulation of the text of each run, in logical order, ready to be drawn with OpenGL.
+     */
+    std::vector<Text> assemble(const std::string& aCharacters, const Language& aLanguage) const;
+
+private:
+    /**
+     * @brief Private Implementation of the font fallback chain
+     */
+    std::shared_ptr<FontStackImpl>  mImplPtr;
+};
+
+} // namespace gltext
@@ -34,25 +34,27 @@ public:
      * @brief Encapsulate the rendered text returned by Font::render(), ready to be drawn with OpenGL.
      *
      *  An OpenGL Vertex Array Object (VAO) is created and initialized with states needed to draw the text.
-     * An OpenGL Index Buffer Object (IBO) is created to index the glyphs to be rendered.
+     * The glyphs are indexed by the Index Buffer Object (IBO) shared by all texts.
      *
      * @param[in] aFontImplPtr  Shared pointer to the Font implementation from which this Text is build.
      * @param[in] aTextLength   Size of text (number of unicode codepoint, number of glyphs in GL buffers).
      * @param[in] aTextVAO      Vertex Array Object used to render the text.
      * @param[in] aTextVBO      Vertex Buffer Object used to render the text.
-     * @param[in] aTextIBO      Index Buffer Object used to render the text.
+     * @param[in] aIndexType    OpenGL type of the shared indices of the glyphs (0 for an instanced text).
+     * @param[in] abInstanced   Is the text stored as one instance per glyph, drawn without any index buffer ?
      */
     explicit Text(const std::shared_ptr<const FontImpl>&    aFontImplPtr,
                   size_t                                    aTextLength,
                   size_t                                    aTextVAO,
                   size_t                                    aTextVBO,
-                  size_t                                    aTextIBO);
+                  unsigned int                              aIndexType,
+                  bool                                      abInstanced = false);
 
     /**
      * @brief Cleanup all Freetype and OpenGL ressources when the last reference is destroyed.
      *
      *  When the last reference to a Text object is destroyed, the TextImpl releases all OpenGL ressources
-     * associated to it (the VAO and IBO).
+     * associated to it (the VAO and VBO).
      *  When the last reference to its upstream Font object is destroyed, the FontImpl also releases
      * the Texture and all Freetype ressources owned by the Font.
      */
@@ -73,6 +75,20 @@ public:
      */
     void setPosition(float aX, float aY, float aZ);
 
+    /**
+     * @brief Set the offset and the scale converting the positions of the glyphs, in pixels, to OpenGL clip coordinates.
+     *
+     *  Each vertex is drawn at ((position + offset) * scale). For instance, an offset of (-width/2, -height/2)
+     * and a scale of (2/width, 2/height) maps a viewport of width x height pixels, with its origin at the bottom
+     * left corner. Defaults to an offset of (-200, -200) and a scale of (1/256, 1/256), as for TextBatch.
+     *
+     * @param[in] aOffsetX  Horizontal offset added to the positions, in pixels.
+     * @param[in] aOffsetY  Vertical offset added to the positions, in pixels.
+     * @param[in] aScaleX   Horizontal scale from offset positions to clip coordinates.
+     * @param[in] aScaleY   Vertical scale from offset positions to clip coordinates.
+     */
+    void setTransform(float aOffsetX, float aOffsetY, float aScaleX, float aScaleY);
+
     /**
      * @brief Ask OpenGL to draw the pre-rendered static text, using the current binded program, at current position.
      *
@@ -80,7 +96,29 @@ public:
      */
     void draw();
 
+    /**
+     * @brief Defragment the vertex buffers shared by all the texts, releasing the memory left by destroyed texts.
+     *
+     *  Most texts do not own their OpenGL buffers, but a slice of a few large Vertex Buffer Objects shared by all
+     * texts, which avoids creating and destroying OpenGL objects for each Text. Destroying texts leaves holes into
+     * these buffers, reused by the next texts of the same size or smaller; call compact() from time to time,
+     * for instance after releasing many texts, to move all the remaining texts together and release the rest.
+     *
+     *  Must be called from the thread owning the OpenGL context.
+     */
+    static void compact();
+
 private:
+    friend class TextBatch;
+    friend class FontImpl;
+
+    /**
+     * @brief Give a new reference to an already built Text implementation.
+     *
+     * @param[in] aImplPtr  Shared pointer to the Private Implementation of the Text.
+     */
+    explicit Text(const std::shared_ptr<TextImpl>& aImplPtr);
+
     /**
      * @brief Private Implementation of the rendered text.
      */
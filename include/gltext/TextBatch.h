@@ -0,0 +1,99 @@
+/**
+ * @file    TextBatch.h
+ * @brief   Collection of many texts drawn together, with a single OpenGL draw call per cache texture.
+ *
+ * Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <memory>   // for std::shared_ptr
+
+#include <gltext/Text.h>
+
+namespace gltext {
+
+/**
+ * @brief Private Implementation of the batch of texts.
+ */
+class TextBatchImpl;
+
+/**
+ * @brief Collection of many texts drawn together, with a single OpenGL draw call per cache texture.
+ *
+ *  Drawing each Text on its own rebinds the program, the texture and the VAO of the text, and issues one draw call
+ * per text, which overhead dominates the frame time with thousands of small labels.
+ * A TextBatch copies the vertices of all its texts sharing the same cache texture (that is, assembled from the same
+ * Font) into one vertex buffer, directly on the GPU, along with the position and the color of each text,
+ * and then draws each of these streams with only one draw call.
+ * Texts assembled as one instance per glyph (see Font::assembleInstanced()) get their own instanced streams.
+ *
+ *  The streams are only rebuilt by the first draw() after texts are added or the batch is cleared.
+ * The batch keeps a reference to its texts, which can thus be released by the application.
+ *
+ *  As for Text, the TextBatch must only be used from the thread owning the OpenGL context.
+ *
+ *  Default Copy Constructor and Assignment Operator only copy the shared pointeur,
+ * which give a new reference to the TextBatch instance.
+ */
+class TextBatch {
+public:
+    /**
+     * @brief Create an empty batch.
+     */
+    TextBatch();
+
+    /**
+     * @brief Cleanup all OpenGL ressources when the last reference is destroyed.
+     */
+    ~TextBatch();
+
+    // NOTE : see #TextBatch class header about Copy & Assignment
+
+    /**
+     * @brief Add a text to the batch, to be drawn at the given position with the given color.
+     *
+     * @param[in] aText     Text to draw, assembled from any Font.
+     * @param[in] aX        X coordinate of where to start drawing the text.
+     * @param[in] aY        Y coordinate of where to start drawing the text.
+     * @param[in] aRed      Red component of the color of the text, in the range [0.0f; 1.0f].
+     * @param[in] aGreen    Green component of the color of the text, in the range [0.0f; 1.0f].
+     * @param[in] aBlue     Blue component of the color of the text, in the range [0.0f; 1.0f].
+     */
+    void add(const Text& aText, float aX, float aY, float aRed = 1.0f, float aGreen = 1.0f, float aBlue = 1.0f);
+
+    /**
+     * @brief Remove all the texts from the batch.
+     */
+    void clear();
+
+    /**
+     * @brief Set the offset and the scale converting the positions of the texts, in pixels, to OpenGL clip coordinates.
+     *
+     *  Each vertex is drawn at ((position + offset) * scale), where position is the one of the vertex in its text
+     * plus the one given to add(). For instance, an offset of (-width/2, -height/2) and a scale of
+     * (2/width, 2/height) maps a viewport of width x height pixels, with its origin at the bottom left corner.
+     * Defaults to an offset of (-200, -200) and a scale of (1/256, 1/256).
+     *
+     * @param[in] aOffsetX  Horizontal offset added to the positions, in pixels.
+     * @param[in] aOffsetY  Vertical offset added to the positions, in pixels.
+     * @param[in] aScaleX   Horizontal scale from offset positions to clip coordinates.
+     * @param[in] aScaleY   Vertical scale from offset positions to clip coordinates.
+     */
+    void setTransform(float aOffsetX, float aOffsetY, float aScaleX, float aScaleY);
+
+    /**
+     * @brief Ask OpenGL to draw all the texts of the batch, with one draw call per cache texture.
+     */
+    void draw();
+
+private:
+    /**
+     * @brief Private Implementation of the batch of texts.
+     */
+    std::shared_ptr<TextBatchImpl>  mImplPtr;
+};
+
+} // namespace gltext
@@ -0,0 +1,308 @@
+/**
+ * @file    BMFont.cpp
+ * @brief   Prebuilt bitmap font in the AngelCode BMFont format: a descriptor and its TGA page images.
+ *
+ * Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "BMFont.h"     // NOLINT TODO
+#include "MappedFile.h" // NOLINT TODO
+#include "Exception.h"  // NOLINT TODO
+
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace gltext {
+
+/// Maximum number of page images, as each glyph stores the index of its page on a byte
+static const int _MaxPages = 256;
+
+/// Read a little-endian unsigned 16 bits integer
+static inline uint16_t readU16(const unsigned char* apData) {
+    return static_cast<uint16_t>(apData[0] | (apData[1] << 8));
+}
+
+/// Read a little-endian unsigned 32 bits integer
+static inline uint32_t readU32(const unsigned char* apData) {
+    return apData[0] | (apData[1] << 8) | (apData[2] << 16) | (static_cast<uint32_t>(apData[3]) << 24);
+}
+
+/// Key/value pairs of a line of a descriptor in the text format
+typedef std::map<std::string, std::string> Attributes;
+
+/**
+ * @brief Split a line of a descriptor in the text format, like 'page id=0 file="font_0.tga"', into its tag
+ * and its attributes.
+ */
+static void parseLine(const std::string& aLine, std::string& aTag, Attributes& aAttributes) {
+    size_t pos = aLine.find_first_not_of(" \t");
+    size_t end = aLine.find_first_of(" \t", pos);
+    aTag = (std::string::npos != pos) ? aLine.substr(pos, end - pos) : std::string();
+    aAttributes.clear();
+    pos = end;
+    while (std::string::npos != pos) {
+        pos = aLine.find_first_not_of(" \t", pos);
+        if (std::string::npos == pos) {
+            break;
+        }
+        const size_t equal = aLine.find('=', pos);
+        if (std::string::npos == equal) {
+            break;
+        }
+        const std::string key = aLine.substr(pos, equal - pos);
+        if ((equal + 1 < aLine.size()) && ('"' == aLine[equal + 1])) {
+            end = aLine.find('"', equal + 2);
+            aAttributes[key] = aLine.substr(equal + 2, end - (equal + 2));
+            pos = (std::string::npos != end) ? end + 1 : end;
+        } else {
+            end = aLine.find_first_of(" \t", equal + 1);
+            aAttributes[key] = aLine.substr(equal + 1, end - (equal + 1));
+            pos = end;
+        }
+    }
+}
+
+/// Get an integer attribute of a line of a descriptor in the text format (0 if missing)
+static int getInt(const Attributes& aAttributes, const char* apKey) {
+    Attributes::const_iterator iAttribute = aAttributes.find(apKey);
+    return (aAttributes.end() != iAttribute) ? atoi(iAttribute->second.c_str()) : 0;
+}
+
+// Read and check the descriptor of a BMFont, either in the text or in the binary format.
+BMFont::BMFont(const char* apPathFilename) :
+    mPathFilename(apPathFilename),
+    mLineHeight(0),
+    mBase(0),
+    mWidth(0),
+    mHeight(0),
+    mAlphaChannel(0),
+    mbPacked(false) {
+    MappedFile file(apPathFilename);
+    if ((file.getSize() >= 4) && (0 == memcmp(file.getData(), "BMF", 3))) {
+        parseBinary(file.getData(), file.getSize());
+    } else {
+        parseText(file.getData(), file.getSize());
+    }
+
+    if ((0 == mWidth) || (0 == mHeight) || mPages.empty()) {
+        throw Exception(mPathFilename + ": missing common block or pages");
+    }
+    if (mPages.size() > static_cast<size_t>(_MaxPages)) {
+        throw Exception(mPathFilename + ": too many pages");
+    }
+    if (mbPacked) {
+        throw Exception(mPathFilename + ": glyphs packed into color channels are not supported");
+    }
+    for (size_t i = 0; i < mChars.size(); ++i) {
+        const Char& chr = mChars[i];
+        if ((chr.page >= mPages.size()) || (chr.x + chr.width > mWidth) || (chr.y + chr.height > mHeight)) {
+            throw Exception(mPathFilename + ": glyph out of its page");
+        }
+    }
+
+    // Page images are named relatively to the descriptor
+    const size_t separator = mPathFilename.find_last_of("/\\");
+    const std::string directory = (std::string::npos != separator) ? mPathFilename.substr(0, separator + 1) : "";
+    for (size_t i = 0; i < mPages.size(); ++i) {
+        mPages[i] = directory + mPages[i];
+    }
+}
+
+// Parse a descriptor in the binary format.
+void BMFont::parseBinary(const unsigned char* apData, size_t aSize) {
+    if (3 != apData[3]) {
+        throw Exception(mPathFilename + ": unsupported BMFont binary version");
+    }
+    // Blocks: a type byte, the size of the block content, then the content
+    size_t offset = 4;
+    while (offset + 5 <= aSize) {
+        const unsigned char type = apData[offset];
+        const size_t size = readU32(apData + offset + 1);
+        const unsigned char* pBlock = apData + offset + 5;
+        offset += 5 + size;
+        if (offset > aSize) {
+            throw Exception(mPathFilename + ": truncated block");
+        }
+        switch (type) {
+        case 2: // common
+            if (size < 15) {
+                throw Exception(mPathFilename + ": truncated common block");
+            }
+            mLineHeight = readU16(pBlock);
+            mBase = readU16(pBlock + 2);
+            mWidth = readU16(pBlock + 4);
+            mHeight = readU16(pBlock + 6);
+            mbPacked = (0 != (pBlock[10] & 0x01));
+            mAlphaChannel = pBlock[11];
+            break;
+        case 3: // pages: null terminated file names
+            for (size_t pos = 0; pos < size; ) {
+                const char* pName = reinterpret_cast<const char*>(pBlock + pos);
+                const size_t length = strnlen(pName, size - pos);
+                mPages.push_back(std::string(pName, length));
+                pos += length + 1;
+            }
+            break;
+        case 4: // chars: 20 bytes each
+            for (size_t pos = 0; pos + 20 <= size; pos += 20) {
+                Char chr;
+                chr.id = readU32(pBlock + pos);
+                chr.x = readU16(pBlock + pos + 4);
+                chr.y = readU16(pBlock + pos + 6);
+                chr.width = readU16(pBlock + pos + 8);
+                chr.height = readU16(pBlock + pos + 10);
+                chr.xoffset = static_cast<int16_t>(readU16(pBlock + pos + 12));
+                chr.yoffset = static_cast<int16_t>(readU16(pBlock + pos + 14));
+                chr.xadvance = static_cast<int16_t>(readU16(pBlock + pos + 16));
+                chr.page = pBlock[pos + 18];
+                mChars.push_back(chr);
+            }
+            break;
+        case 5: // kerning pairs: 10 bytes each
+            for (size_t pos = 0; pos + 10 <= size; pos += 10) {
+                Kerning kerning;
+                kerning.first = readU32(pBlock + pos);
+                kerning.second = readU32(pBlock + pos + 4);
+                kerning.amount = static_cast<int16_t>(readU16(pBlock + pos + 8));
+                mKernings.push_back(kerning);
+            }
+            break;
+        default: // info, or unknown block
+            break;
+        }
+    }
+}
+
+// Parse a descriptor in the text format.
+void BMFont::parseText(const unsigned char* apData, size_t aSize) {
+    const std::string content(reinterpret_cast<const char*>(apData), aSize);
+    std::string tag;
+    Attributes attributes;
+    size_t pos = 0;
+    while (pos < content.size()) {
+        size_t end = content.find('\n', pos);
+        if (std::string::npos == end) {
+            end = content.size();
+        }
+        std::string line = content.substr(pos, end - pos);
+        if (!line.empty() && ('\r' == line[line.size() - 1])) {
+            line.resize(line.size() - 1);
+        }
+        pos = end + 1;
+
+        parseLine(line, tag, attributes);
+        if ("common" == tag) {
+            mLineHeight = getInt(attributes, "lineHeight");
+            mBase = getInt(attributes, "base");
+            mWidth = getInt(attributes, "scaleW");
+            mHeight = getInt(attributes, "scaleH");
+            mbPacked = (0 != getInt(attributes, "packed"));
+            mAlphaChannel = getInt(attributes, "alphaChnl");
+        } else if ("page" == tag) {
+            const int id = getInt(attributes, "id");
+            if ((id < 0) || (id >= _MaxPages)) {
+                throw Exception(mPathFilename + ": page id out of range");
+            }
+            if (static_cast<size_t>(id) >= mPages.size()) {
+                mPages.resize(id + 1);
+            }
+            mPages[id] = attributes["file"];
+        } else if ("char" == tag) {
+            Char chr;
+            chr.id = static_cast<uint32_t>(getInt(attributes, "id"));
+            chr.x = static_cast<uint16_t>(getInt(attributes, "x"));
+            chr.y = static_cast<uint16_t>(getInt(attributes, "y"));
+            chr.width = static_cast<uint16_t>(getInt(attributes, "width"));
+            chr.height = static_cast<uint16_t>(getInt(attributes, "height"));
+            chr.xoffset = static_cast<int16_t>(getInt(attributes, "xoffset"));
+            chr.yoffset = static_cast<int16_t>(getInt(attributes, "yoffset"));
+            chr.xadvance = static_cast<int16_t>(getInt(attributes, "xadvance"));
+            chr.page = static_cast<uint8_t>(getInt(attributes, "page"));
+            mChars.push_back(chr);
+        } else if ("kerning" == tag) {
+            Kerning kerning;
+            kerning.first = static_cast<uint32_t>(getInt(attributes, "first"));
+            kerning.second = static_cast<uint32_t>(getInt(attributes, "second"));
+            kerning.amount = static_cast<int16_t>(getInt(attributes, "amount"));
+            mKernings.push_back(kerning);
+        } else if (mPages.empty() && mChars.empty() && ("info" != tag) && !tag.empty()) {
+            throw Exception(mPathFilename + ": not a BMFont descriptor");
+        }
+    }
+}
+
+// Load a page image, keeping only the coverage of the glyphs (one byte per pixel, top row first).
+void BMFont::loadPage(size_t aPage, std::vector<unsigned char>& aPixels) const {
+    const std::string& path = mPages[aPage];
+    MappedFile file(path.c_str());
+    const unsigned char* pData = file.getData();
+    const size_t size = file.getSize();
+
+    // TGA header
+    if (size < 18) {
+        throw Exception(path + ": truncated TGA header");
+    }
+    const unsigned char type = pData[2];
+    const unsigned int width = readU16(pData + 12);
+    const unsigned int height = readU16(pData + 14);
+    const unsigned int bitsPerPixel = pData[16];
+    const bool bTopFirst = (0 != (pData[17] & 0x20));
+    const bool bRle = (type >= 8);
+    if ((0 != pData[1]) || ((2 != (type & 7)) && (3 != (type & 7)))) {
+        throw Exception(path + ": only truecolor and grayscale TGA images are supported");
+    }
+    if ((width != mWidth) || (height != mHeight)) {
+        throw Exception(path + ": TGA image size differs from the BMFont descriptor");
+    }
+    // Keep the gray level, or the alpha channel (the red one if alpha is only a constant value), of BGR(A) pixels
+    size_t channel;
+    if ((3 == (type & 7)) && (8 == bitsPerPixel)) {
+        channel = 0;
+    } else if ((2 == (type & 7)) && (32 == bitsPerPixel) && (mAlphaChannel < 3)) {
+        channel = 3;
+    } else if ((2 == (type & 7)) && ((24 == bitsPerPixel) || (32 == bitsPerPixel))) {
+        channel = 2;
+    } else {
+        throw Exception(path + ": only 8, 24 and 32 bits TGA images are supported");
+    }
+    const size_t bytesPerPixel = bitsPerPixel / 8;
+
+    // Pixels, optionally run-length encoded, bottom row first unless said otherwise
+    aPixels.resize(width * height);
+    size_t offset = 18 + pData[0];
+    size_t nbPixels = 0;
+    while (nbPixels < aPixels.size()) {
+        size_t count = 1;
+        bool bRepeat = false;
+        if (bRle) {
+            if (offset >= size) {
+                break;
+            }
+            count = (pData[offset] & 0x7F) + 1;
+            bRepeat = (0 != (pData[offset] & 0x80));
+            ++offset;
+        }
+        for (size_t i = 0; (i < count) && (nbPixels < aPixels.size()); ++i, ++nbPixels) {
+            if (offset + bytesPerPixel > size) {
+                throw Exception(path + ": truncated TGA image");
+            }
+            const size_t row = nbPixels / width;
+            const size_t column = nbPixels % width;
+            aPixels[(bTopFirst ? row : (height - 1 - row)) * width + column] = pData[offset + channel];
+            if (!bRepeat || (i + 1 == count)) {
+                offset += bytesPerPixel;
+            }
+        }
+    }
+    if (nbPixels < aPixels.size()) {
+        throw Exception(path + ": truncated TGA image");
+    }
+}
+
+} // namespace gltext
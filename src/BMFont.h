@@ -0,0 +1,127 @@
+/**
+ * @file    BMFont.h
+ * @brief   Prebuilt bitmap font in the AngelCode BMFont format: a descriptor and its TGA page images.
+ *
+ * Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace gltext {
+
+/**
+ * @brief Prebuilt bitmap font in the AngelCode BMFont format: a descriptor and its TGA page images.
+ *
+ *  Both the text and the binary (version 3) descriptor formats are supported. Page images must be
+ * uncompressed or RLE compressed TGA files, either 8 bits grayscale or 32 bits with the glyphs in the alpha channel.
+ * Fonts packing glyphs into separate color channels are not supported.
+ *
+ *  Reading a BMFont does not involve Freetype nor HarfBuzz: the glyphs are used as they are,
+ * laid out one after the other with the kerning pairs of the descriptor.
+ */
+class BMFont {
+public:
+    /// Description of a glyph, that is a rectangle in one of the page images
+    struct Char {
+        uint32_t    id;         ///< Unicode codepoint of the character
+        uint16_t    x;          ///< Left position of the glyph in the page image, in pixels
+        uint16_t    y;          ///< Top position of the glyph in the page image, in pixels
+        uint16_t    width;      ///< Width of the glyph in the page image, in pixels
+        uint16_t    height;     ///< Height of the glyph in the page image, in pixels
+        int16_t     xoffset;    ///< Horizontal offset from the pen position to the left of the glyph
+        int16_t     yoffset;    ///< Vertical offset from the top of the line to the top of the glyph
+        int16_t     xadvance;   ///< Horizontal advance of the pen position after the glyph
+        uint8_t     page;       ///< Index of the page image holding the glyph
+    };
+
+    /// Horizontal adjustment of the pen position between two characters
+    struct Kerning {
+        uint32_t    first;      ///< Unicode codepoint of the first character
+        uint32_t    second;     ///< Unicode codepoint of the second character
+        int16_t     amount;     ///< Adjustment of the pen position before the second character
+    };
+
+    /**
+     * @brief Read and check the descriptor of a BMFont, either in the text or in the binary format.
+     *
+     * @param[in] apPathFilename    Path to the BMFont descriptor (.fnt) file, the page images being next to it.
+     *
+     * @throw a gltext::Exception if the file cannot be read, or is not a supported BMFont descriptor.
+     */
+    explicit BMFont(const char* apPathFilename);
+
+    /**
+     * @brief Load a page image, keeping only the coverage of the glyphs (one byte per pixel, top row first).
+     *
+     * @param[in]  aPage    Index of the page image to load.
+     * @param[out] aPixels  Coverage of the pixels of the page, getWidth() x getHeight() bytes.
+     *
+     * @throw a gltext::Exception if the image cannot be read, or is not a supported TGA image of the right size.
+     */
+    void loadPage(size_t aPage, std::vector<unsigned char>& aPixels) const;
+
+    /// Path to the descriptor file
+    inline const std::string& getPathFilename() const {
+        return mPathFilename;
+    }
+    /// Distance between two lines of text, in pixels
+    inline unsigned int getLineHeight() const {
+        return mLineHeight;
+    }
+    /// Distance from the top of a line of text to the baseline, in pixels
+    inline unsigned int getBase() const {
+        return mBase;
+    }
+    /// Width of the page images, in pixels
+    inline unsigned int getWidth() const {
+        return mWidth;
+    }
+    /// Height of the page images, in pixels
+    inline unsigned int getHeight() const {
+        return mHeight;
+    }
+    /// Number of page images
+    inline size_t getNbPages() const {
+        return mPages.size();
+    }
+    /// Description of all the glyphs
+    inline const std::vector<Char>& getChars() const {
+        return mChars;
+    }
+    /// All the kerning pairs
+    inline const std::vector<Kerning>& getKernings() const {
+        return mKernings;
+    }
+
+private:
+    /**
+     * @brief Parse a descriptor in the binary format.
+     */
+    void parseBinary(const unsigned char* apData, size_t aSize);
+
+    /**
+     * @brief Parse a descriptor in the text format.
+     */
+    void parseText(const unsigned char* apData, size_t aSize);
+
+private:
+    std::string                 mPathFilename;  ///< Path to the descriptor file
+    unsigned int                mLineHeight;    ///< Distance between two lines of text, in pixels
+    unsigned int                mBase;          ///< Distance from the top of a line of text to the baseline
+    unsigned int                mWidth;         ///< Width of the page images, in pixels
+    unsigned int                mHeight;        ///< Height of the page images, in pixels
+    unsigned int                mAlphaChannel;  ///< Content of the alpha channel (0 for the glyphs)
+    bool                        mbPacked;       ///< Are glyphs packed into separate color channels ?
+    std::vector<std::string>    mPages;         ///< Path to each of the page images
+    std::vector<Char>           mChars;         ///< Description of all the glyphs
+    std::vector<Kerning>        mKernings;      ///< All the kerning pairs
+};
+
+} // namespace gltext
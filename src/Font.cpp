@@ -14,12 +14,42 @@
 
 #include <cassert>
 #include <string>
+#include <vector>
 
 namespace gltext {
 
+// Intern the given language tag.
+Language::Language(const std::string& aTag) :
+    mHandle(aTag.empty() ? HB_LANGUAGE_INVALID : hb_language_from_string(aTag.c_str(), aTag.size())) {
+}
+
+// Get the canonical form of the language tag.
+const char* Language::getTag() const {
+    const char* pTag = hb_language_to_string(static_cast<hb_language_t>(mHandle));
+    return (NULL != pTag) ? pTag : "";
+}
+
 // Ask Freetype to open a Font file and initialize it with the given size
-Font::Font(const char* apPathFilename, unsigned int aPixelSize /* = 16 */, unsigned int aCacheSize /* = 100 */) {
-    mImplPtr.reset(new FontImpl(apPathFilename, aPixelSize, aCacheSize));
+Font::Font(const char* apPathFilename, unsigned int aPixelSize /* = 16 */, unsigned int aCacheSize /* = 100 */,
+           const std::vector<ShapingPlan>& aShapingPlans /* = std::vector<ShapingPlan>() */) {
+    mImplPtr.reset(new FontImpl(FontFile::get(apPathFilename, 0), aPixelSize, aCacheSize, aShapingPlans));
+}
+
+// Ask Freetype to read a Font from memory without copying it, and initialize it with the given size
+Font::Font(const unsigned char* apData, size_t aSize, unsigned int aPixelSize /* = 16 */,
+           unsigned int aCacheSize /* = 100 */,
+           const std::vector<ShapingPlan>& aShapingPlans /* = std::vector<ShapingPlan>() */) {
+    mImplPtr.reset(new FontImpl(FontFile::get(apData, aSize, 0), aPixelSize, aCacheSize, aShapingPlans));
+}
+
+// Load a prebuilt bitmap font in the AngelCode BMFont format, without Freetype nor HarfBuzz.
+Font Font::loadBMFont(const char* apPathFilename) {
+    return Font(std::make_shared<FontImpl>(BMFont(apPathFilename)));
+}
+
+// Give a new reference to an already loaded Font implementation.
+Font::Font(const std::shared_ptr<FontImpl>& aImplPtr) :
+    mImplPtr(aImplPtr) {
 }
 
 // Cleanup all Freetype and OpenGL ressources when the last reference is destroyed.
@@ -38,7 +68,32 @@ float Font::cache(const std::string& aCharacters) {
 Text Font::assemble(const std::string& aCharacters) const {
     assert(mImplPtr);
 
-    return mImplPtr->assemble(aCharacters, mImplPtr);
+    size_t positionX = 0;
+    return mImplPtr->assemble(aCharacters, HB_LANGUAGE_INVALID, positionX, false, mImplPtr);
+}
+
+// Assemble data from cached glyphs to represent the given string of characters in the given language.
+Text Font::assemble(const std::string& aCharacters, const Language& aLanguage) const {
+    assert(mImplPtr);
+
+    size_t positionX = 0;
+    return mImplPtr->assemble(aCharacters, static_cast<hb_language_t>(aLanguage.mHandle), positionX, false,
+                              mImplPtr);
+}
+
+// Assemble data from cached glyphs to represent the given string of characters, as one instance per glyph.
+Text Font::assembleInstanced(const std::string& aCharacters) const {
+    assert(mImplPtr);
+
+    size_t positionX = 0;
+    return mImplPtr->assemble(aCharacters, HB_LANGUAGE_INVALID, positionX, true, mImplPtr);
+}
+
+// Assemble data from cached glyphs for many strings at once, shaping them on worker threads.
+std::vector<Text> Font::assembleBatch(const std::vector<std::string>& aStrings) const {
+    assert(mImplPtr);
+
+    return mImplPtr->assembleBatch(aStrings, mImplPtr);
 }
 
 // Draw the cache texture for debug purpose.
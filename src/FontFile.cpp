@@ -0,0 +1,135 @@
+/**
+ * @file    FontFile.cpp
+ * @brief   Font file shared by all the Font opened on it, through a process-wide registry.
+ *
+ * Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "FontFile.h"   // NOLINT TODO
+#include "Exception.h"  // NOLINT TODO
+
+#include <mutex>        // NOLINT TODO
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace gltext {
+
+/// Mutex protecting both registries of font files (never destroyed, as font files can be closed at any time at exit)
+static std::mutex& getRegistryMutex() {
+    static std::mutex* _pRegistryMutex = new std::mutex();
+    return *_pRegistryMutex;
+}
+
+// Access the registry of the open font files, protected by the registry mutex.
+FontFile::Registry& FontFile::getRegistry() {
+    static Registry* _pRegistry = new Registry();
+    return *_pRegistry;
+}
+
+// Access the registry of the font files already in memory, protected by the registry mutex.
+FontFile::MemoryRegistry& FontFile::getMemoryRegistry() {
+    static MemoryRegistry* _pRegistry = new MemoryRegistry();
+    return *_pRegistry;
+}
+
+/**
+ * @brief Look up the given registry, opening the font file with the given function if it is not already open.
+ *
+ * @param[in] aRegistry Registry of font files, protected by getRegistryMutex().
+ * @param[in] aKey      Key of the font file in the registry.
+ * @param[in] aOpen     Function opening the font file, returning a new FontFile or throwing.
+ */
+template<typename Registry, typename Open>
+static std::shared_ptr<FontFile> getOrOpen(Registry& aRegistry, const typename Registry::key_type& aKey, Open aOpen) {
+    std::lock_guard<std::mutex> lock(getRegistryMutex());
+    std::weak_ptr<FontFile>& entry = aRegistry[aKey];
+    std::shared_ptr<FontFile> fontFile = entry.lock();
+    if (!fontFile) {
+        try {
+            fontFile.reset(aOpen());
+        } catch (...) {
+            aRegistry.erase(aKey);
+            throw;
+        }
+        entry = fontFile;
+    }
+    return fontFile;
+}
+
+/**
+ * @brief Remove the entry of a font file being closed from the given registry, unless it was opened again meanwhile.
+ *
+ * @param[in] aRegistry Registry of font files, protected by getRegistryMutex().
+ * @param[in] aKey      Key of the font file in the registry.
+ */
+template<typename Registry>
+static void eraseExpired(Registry& aRegistry, const typename Registry::key_type& aKey) {
+    std::lock_guard<std::mutex> lock(getRegistryMutex());
+    typename Registry::iterator iEntry = aRegistry.find(aKey);
+    if ((iEntry != aRegistry.end()) && iEntry->second.expired()) {
+        aRegistry.erase(iEntry);
+    }
+}
+
+// Get the font file of the given path and face index, opening it if it is not already open.
+std::shared_ptr<FontFile> FontFile::get(const std::string& aPathFilename, unsigned int aFaceIndex) {
+    return getOrOpen(getRegistry(), std::make_pair(aPathFilename, aFaceIndex), [&]() {
+        return new FontFile(aPathFilename, aFaceIndex);
+    });
+}
+
+// Get the font file of the given font data already in memory, like a font embedded in the binary.
+std::shared_ptr<FontFile> FontFile::get(const unsigned char* apData, size_t aSize, unsigned int aFaceIndex) {
+    if ((NULL == apData) || (0 == aSize)) {
+        throw Exception("empty font data");
+    }
+    return getOrOpen(getMemoryRegistry(), std::make_tuple(apData, aSize, aFaceIndex), [&]() {
+        return new FontFile(apData, aSize, aFaceIndex);
+    });
+}
+
+// Map the font file in memory, and create the HarfBuzz face reading it in place.
+FontFile::FontFile(const std::string& aPathFilename, unsigned int aFaceIndex) :
+    mName(aPathFilename),
+    mpFile(new MappedFile(aPathFilename.c_str())),
+    mpData(mpFile->getData()),
+    mSize(mpFile->getSize()),
+    mFaceIndex(aFaceIndex) {
+    createFace();
+}
+
+// Create the HarfBuzz face reading the given font data in place.
+FontFile::FontFile(const unsigned char* apData, size_t aSize, unsigned int aFaceIndex) :
+    mpData(apData),
+    mSize(aSize),
+    mFaceIndex(aFaceIndex) {
+    std::ostringstream name;
+    name << "memory:" << static_cast<const void*>(apData) << "+" << aSize;
+    mName = name.str();
+    createFace();
+}
+
+// Close the font file, and remove it from the registry.
+FontFile::~FontFile() {
+    hb_face_destroy(mpFace);
+    if (mpFile) {
+        eraseExpired(getRegistry(), std::make_pair(mName, mFaceIndex));
+    } else {
+        eraseExpired(getMemoryRegistry(), std::make_tuple(mpData, mSize, mFaceIndex));
+    }
+}
+
+// Create the HarfBuzz face reading the font data in place.
+void FontFile::createFace() {
+    hb_blob_t* blob = hb_blob_create(reinterpret_cast<const char*>(mpData), static_cast<unsigned int>(mSize),
+                                     HB_MEMORY_MODE_READONLY, NULL, NULL);
+    mpFace = hb_face_create(blob, mFaceIndex);
+    hb_blob_destroy(blob);
+}
+
+} // namespace gltext
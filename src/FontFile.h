@@ -0,0 +1,152 @@
+/**
+ * @file    FontFile.h
+ * @brief   Font file shared by all the Font opened on it, through a process-wide registry.
+ *
+ * Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <string>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include <hb.h>         // HarfBuzz face
+
+#include "MappedFile.h" // NOLINT TODO
+
+namespace gltext {
+
+/**
+ * @brief Font file shared by all the Font opened on it, through a process-wide registry.
+ *
+ *  Holds the memory mapping of the file and the HarfBuzz face reading it in place, that is its sanitized
+ * OpenType tables, cached shaping plans and lookup accelerators, so that opening the same font again,
+ * at another size or from another part of the application, does not parse it again.
+ * Each Font still has its own Freetype face opened on the same memory (see getData()),
+ * as the pixel size is a property of the Freetype face.
+ *
+ *  A font file can also be a font embedded in the application binary, read in place without any mapping.
+ */
+class FontFile {
+public:
+    /**
+     * @brief Get the font file of the given path and face index, opening it if it is not already open.
+     *
+     *  Thread-safe. The registry only keeps weak references: a font file is closed, and removed from the registry,
+     * when the last Font using it is destroyed.
+     *
+     * @param[in] aPathFilename Path to the OpenType font file.
+     * @param[in] aFaceIndex    Index of the face in the font file (0 but for font collections).
+     *
+     * @throw a gltext::Exception if the file cannot be opened.
+     */
+    static std::shared_ptr<FontFile> get(const std::string& aPathFilename, unsigned int aFaceIndex);
+
+    /**
+     * @brief Get the font file of the given font data already in memory, like a font embedded in the binary.
+     *
+     *  Thread-safe. The data is read in place, and must remain valid as long as any Font uses it.
+     *
+     * @param[in] apData        Content of the OpenType font file.
+     * @param[in] aSize         Size of the content in bytes.
+     * @param[in] aFaceIndex    Index of the face in the font file (0 but for font collections).
+     *
+     * @throw a gltext::Exception if the data is empty.
+     */
+    static std::shared_ptr<FontFile> get(const unsigned char* apData, size_t aSize, unsigned int aFaceIndex);
+
+    /**
+     * @brief Close the font file, and remove it from the registry.
+     *
+     * @warning All HarfBuzz fonts created on its face must have been destroyed before.
+     */
+    ~FontFile();
+
+    /**
+     * @brief Get the path of the font file, or a description of the memory holding it.
+     */
+    inline const std::string& getName() const {
+        return mName;
+    }
+    /**
+     * @brief Access the HarfBuzz face, to create HarfBuzz fonts on it.
+     */
+    inline hb_face_t* getFace() const {
+        return mpFace;
+    }
+    /**
+     * @brief Access the content of the font file, to open a Freetype face on it.
+     */
+    inline const unsigned char* getData() const {
+        return mpData;
+    }
+    /**
+     * @brief Get the size of the content of the font file in bytes.
+     */
+    inline size_t getSize() const {
+        return mSize;
+    }
+    /**
+     * @brief Get the index of the face in the font file.
+     */
+    inline unsigned int getFaceIndex() const {
+        return mFaceIndex;
+    }
+
+private:
+    /**
+     * @brief Map the font file in memory, and create the HarfBuzz face reading it in place.
+     *
+     * @param[in] aPathFilename Path to the OpenType font file.
+     * @param[in] aFaceIndex    Index of the face in the font file.
+     */
+    FontFile(const std::string& aPathFilename, unsigned int aFaceIndex);
+
+    /**
+     * @brief Create the HarfBuzz face reading the given font data in place.
+     *
+     * @param[in] apData        Content of the OpenType font file.
+     * @param[in] aSize         Size of the content in bytes.
+     * @param[in] aFaceIndex    Index of the face in the font file.
+     */
+    FontFile(const unsigned char* apData, size_t aSize, unsigned int aFaceIndex);
+
+    /// Non copyable: the mapping and the face are owned by the object.
+    FontFile(const FontFile&);
+    /// Non copyable: the mapping and the face are owned by the object.
+    FontFile& operator=(const FontFile&);
+
+    /**
+     * @brief Create the HarfBuzz face reading the font data in place.
+     */
+    void createFace();
+
+    /// Registry of the open font files, by path and face index
+    typedef std::map<std::pair<std::string, unsigned int>, std::weak_ptr<FontFile> >            Registry;
+    /// Registry of the font files already in memory, by address, size and face index
+    typedef std::map<std::tuple<const unsigned char*, size_t, unsigned int>, std::weak_ptr<FontFile> > MemoryRegistry;
+
+    /**
+     * @brief Access the registry of the open font files, protected by the registry mutex.
+     */
+    static Registry& getRegistry();
+    /**
+     * @brief Access the registry of the font files already in memory, protected by the registry mutex.
+     */
+    static MemoryRegistry& getMemoryRegistry();
+
+private:
+    std::string                 mName;      ///< Path of the font file, or description of the memory holding it.
+    std::unique_ptr<MappedFile> mpFile;     ///< The font file, mapped in memory (NULL for a font already in memory).
+    const unsigned char*        mpData;     ///< Content of the font file, mapped or already in memory.
+    size_t                      mSize;      ///< Size of the content of the font file in bytes.
+    unsigned int                mFaceIndex; ///< Index of the face in the font file.
+    hb_face_t*                  mpFace;     ///< HarfBuzz face, reading the font data in place.
+};
+
+} // namespace gltext
@@ -12,34 +12,44 @@
 #include "Freetype.h"   // NOLINT TODO
 #include "Exception.h"  // NOLINT TODO
 #include "Program.h"    // NOLINT TODO
+#include "QuadIndexBuffer.h" // NOLINT TODO
+#include "VertexArena.h"    // NOLINT TODO
+#include "TextImpl.h"       // NOLINT TODO
+#include "Utf8.h"       // NOLINT TODO
 
 #include <stdexcept>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
+#include <limits>
 #include <string>
 #include <vector>
+#include <mutex>        // NOLINT TODO
+#include <thread>       // NOLINT TODO
+#include <exception>
 #include <iostream>     // NOLINT TODO
 
 
 namespace gltext {
 
 // Ask Freetype to open a Font file and initialize it with the given size
-FontImpl::FontImpl(const char* apPathFilename, size_t aPixelSize, size_t aCacheSize) :
-    mPathFilename(apPathFilename) {
-    Freetype& freetype = Freetype::getInstance();
-    // Load the font from file
-    FT_Error error = FT_New_Face(freetype.getLibrary(), mPathFilename.c_str(), 0, &mFace);
-    if (error) {
-        throw Exception("FT_New_Face error");
-    }
-    // Set the vertical pixel size
-    error = FT_Set_Pixel_Sizes(mFace, 0, aPixelSize);
-    if (error) {
-        FT_Done_Face(mFace);
-        throw Exception("FT_Set_Pixel_Sizes error");
+FontImpl::FontImpl(const std::shared_ptr<FontFile>& aFontFile, size_t aPixelSize, size_t aCacheSize,
+                   const std::vector<ShapingPlan>& aShapingPlans) :
+    mFontFile(aFontFile) {
+    // Open a Freetype face on the memory of the font file, at the given pixel size,
+    mFace = openFace(aPixelSize);
+    // and a HarfBuzz font on the shared face of the font file, for text shaping
+    mFont = createFont(mFace);
+    // and precompile the requested shaping plans
+    try {
+        for (size_t i = 0; i < aShapingPlans.size(); ++i) {
+            prepare(aShapingPlans[i]);
+        }
+    } catch (...) {
+        hb_font_destroy(mFont);
+        closeFace(mFace);
+        throw;
     }
-    // Open the font with harfbuzz for text shaping
-    mFont = hb_ft_font_create(mFace, 0);
 
     // Calculate actual font size
     size_t maxSlotWidth = static_cast<size_t>(
@@ -54,10 +64,91 @@ FontImpl::FontImpl(const char* apPathFilename, size_t aPixelSize, size_t aCacheS
     mCacheFreeSlotX = 0;
     mCacheFreeSlotY = 0;
 
-    std::cout << "FontImpl::FontImpl(" << apPathFilename << ", " << aPixelSize << "): "
+    std::cout << "FontImpl::FontImpl(" << mFontFile->getName() << ", " << aPixelSize << "): "
         << maxSlotWidth << "x" << maxSlotHeight
         << " (cache " << mCacheWidth << "x" << mCacheHeight << ")" << std::endl;
 
+    initCache(NULL);
+}
+
+// Load all the glyphs of a prebuilt bitmap font into the cache, without Freetype nor HarfBuzz.
+FontImpl::FontImpl(const BMFont& aBMFont) :
+    mFace(NULL),
+    mFont(NULL) {
+    // All the page images are stacked vertically into the cache texture, which is then full
+    mCacheWidth = aBMFont.getWidth();
+    mCacheHeight = aBMFont.getHeight() * aBMFont.getNbPages();
+    mCacheLineHeight = 0;
+    mCacheFreeSlotX = 0;
+    mCacheFreeSlotY = mCacheHeight;
+    GLint maxTextureSize = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+    if ((mCacheWidth > static_cast<size_t>(maxTextureSize)) || (mCacheHeight > static_cast<size_t>(maxTextureSize))) {
+        throw Exception(aBMFont.getPathFilename() + ": pages too large for the cache texture");
+    }
+
+    std::cout << "FontImpl::FontImpl(" << aBMFont.getPathFilename() << "): "
+        << aBMFont.getChars().size() << " glyphs"
+        << " (cache " << mCacheWidth << "x" << mCacheHeight << ")" << std::endl;
+
+    std::vector<GLubyte> pixels;
+    pixels.reserve(mCacheWidth * mCacheHeight);
+    std::vector<GLubyte> pagePixels;
+    for (size_t page = 0; page < aBMFont.getNbPages(); ++page) {
+        aBMFont.loadPage(page, pagePixels);
+        pixels.insert(pixels.end(), pagePixels.begin(), pagePixels.end());
+    }
+
+    // ^ y/t
+    // |
+    // 2 - 3
+    // | \ |
+    // 0 - 1 -> x/s
+    const std::vector<BMFont::Char>& chars = aBMFont.getChars();
+    for (size_t i = 0; i < chars.size(); ++i) {
+        const size_t slotX = chars[i].x;
+        const size_t slotY = chars[i].page * aBMFont.getHeight() + chars[i].y;
+        const int offsetX = chars[i].xoffset;
+        const int offsetY = static_cast<int>(aBMFont.getBase()) - chars[i].yoffset - chars[i].height; // Can be negative
+
+        GlyphVerticies glyphVerticies;
+
+        glyphVerticies.bl.x = toPosition(offsetX);
+        glyphVerticies.bl.y = toPosition(offsetY);
+        glyphVerticies.bl.s = toTexCoord(slotX, mCacheWidth);
+        glyphVerticies.bl.t = toTexCoord(slotY + chars[i].height, mCacheHeight);
+
+        glyphVerticies.br.x = toPosition(offsetX + chars[i].width);
+        glyphVerticies.br.y = toPosition(offsetY);
+        glyphVerticies.br.s = toTexCoord(slotX + chars[i].width, mCacheWidth);
+        glyphVerticies.br.t = toTexCoord(slotY + chars[i].height, mCacheHeight);
+
+        glyphVerticies.tl.x = toPosition(offsetX);
+        glyphVerticies.tl.y = toPosition(offsetY + chars[i].height);
+        glyphVerticies.tl.s = toTexCoord(slotX, mCacheWidth);
+        glyphVerticies.tl.t = toTexCoord(slotY, mCacheHeight);
+
+        glyphVerticies.tr.x = toPosition(offsetX + chars[i].width);
+        glyphVerticies.tr.y = toPosition(offsetY + chars[i].height);
+        glyphVerticies.tr.s = toTexCoord(slotX + chars[i].width, mCacheWidth);
+        glyphVerticies.tr.t = toTexCoord(slotY, mCacheHeight);
+
+        // Glyphs of a bitmap font are indexed by their Unicode codepoint
+        mCacheGlyphIdxMap[chars[i].id] = mCacheGlyphVertList.size();
+        mCacheGlyphVertList.push_back(glyphVerticies);
+        mCacheGlyphAdvanceList.push_back(chars[i].xadvance);
+    }
+
+    const std::vector<BMFont::Kerning>& kernings = aBMFont.getKernings();
+    for (size_t i = 0; i < kernings.size(); ++i) {
+        mKerningMap[std::make_pair(kernings[i].first, kernings[i].second)] = kernings[i].amount;
+    }
+
+    initCache(&pixels[0]);
+}
+
+// Create the cache texture, and the vertex buffer used for its debug draw.
+void FontImpl::initCache(const GLubyte* apPixels) {
     // For cache debug draw
     // ^ y/t
     // |
@@ -66,56 +157,50 @@ FontImpl::FontImpl(const char* apPathFilename, size_t aPixelSize, size_t aCacheS
     // 0 - 1 -> x/s
     GlyphVerticies glyphVerticies;
 
-    glyphVerticies.bl.x = -1.0f;
-    glyphVerticies.bl.y = -1.0f;
-    glyphVerticies.bl.s = 0.0f;
-    glyphVerticies.bl.t = 1.0f;
-
-    glyphVerticies.br.x = 1.0f;
-    glyphVerticies.br.y = -1.0f;
-    glyphVerticies.br.s = 1.0f;
-    glyphVerticies.br.t = 1.0f;
-
-    glyphVerticies.tl.x = -1.0f;
-    glyphVerticies.tl.y = 1.0f;
-    glyphVerticies.tl.s = 0.0f;
-    glyphVerticies.tl.t = 0.0f;
-
-    glyphVerticies.tr.x = 1.0f;
-    glyphVerticies.tr.y = 1.0f;
-    glyphVerticies.tr.s = 1.0f;
-    glyphVerticies.tr.t = 0.0f;
-
-    GlyphIndices glyphIndicies;
-    glyphIndicies.bl1 = 0;
-    glyphIndicies.br1 = 1;
-    glyphIndicies.tl1 = 2;
-    glyphIndicies.br2 = 1;
-    glyphIndicies.tl2 = 2;
-    glyphIndicies.tr2 = 3;
+    glyphVerticies.bl.x = toPosition(-1);
+    glyphVerticies.bl.y = toPosition(-1);
+    glyphVerticies.bl.s = toTexCoord(0, 1);
+    glyphVerticies.bl.t = toTexCoord(1, 1);
+
+    glyphVerticies.br.x = toPosition(1);
+    glyphVerticies.br.y = toPosition(-1);
+    glyphVerticies.br.s = toTexCoord(1, 1);
+    glyphVerticies.br.t = toTexCoord(1, 1);
+
+    glyphVerticies.tl.x = toPosition(-1);
+    glyphVerticies.tl.y = toPosition(1);
+    glyphVerticies.tl.s = toTexCoord(0, 1);
+    glyphVerticies.tl.t = toTexCoord(0, 1);
+
+    glyphVerticies.tr.x = toPosition(1);
+    glyphVerticies.tr.y = toPosition(1);
+    glyphVerticies.tr.s = toTexCoord(1, 1);
+    glyphVerticies.tr.t = toTexCoord(0, 1);
 
     Program& program = Program::getInstance();
     glUseProgram(program.mProgram);
     glGenVertexArrays(1, &mCacheVAO);
     glGenBuffers(1, &mCacheVBO);
-    glGenBuffers(1, &mCacheIBO);
     glBindVertexArray(mCacheVAO);
     glBindBuffer(GL_ARRAY_BUFFER, mCacheVBO);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mCacheIBO);
-    glBufferData(GL_ARRAY_BUFFER,         sizeof(glyphVerticies), &(glyphVerticies), GL_STATIC_DRAW);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(glyphIndicies),  &(glyphIndicies), GL_STATIC_DRAW);
-    glEnableVertexAttribArray(program.mVertexPositionAttrib);
-    glEnableVertexAttribArray(program.mVertexTextureCoordAttrib);
-    glVertexAttribPointer(program.mVertexPositionAttrib, 2, GL_FLOAT, GL_FALSE, sizeof(GlyphVertex), 0);
-    glVertexAttribPointer(program.mVertexTextureCoordAttrib, 2, GL_FLOAT, GL_FALSE, sizeof(GlyphVertex), reinterpret_cast<GLvoid*>(sizeof(GlyphVertex)/2)); // NOLINT
+    QuadIndexBuffer::getInstance().bind(1);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(glyphVerticies), &(glyphVerticies), GL_STATIC_DRAW);
+    setVertexAttribs(program);
     GL_CHECK();
 
     // Cache texture
     glActiveTexture(GL_TEXTURE0 + _TextureUnitIdx);
     glGenTextures(1, &mCacheTexture);
     glBindTexture(GL_TEXTURE_2D, mCacheTexture);
-    std::vector<GLubyte> emptyData(mCacheWidth * mCacheHeight * sizeof(GLfloat), 0); // transparent black texture
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, mCacheWidth, mCacheHeight, 0, GL_RED, GL_UNSIGNED_BYTE, &emptyData[0]);
+    std::vector<GLubyte> emptyData;
+    if (NULL == apPixels) {
+        emptyData.resize(mCacheWidth * mCacheHeight * sizeof(GLfloat), 0); // transparent black texture
+        apPixels = &emptyData[0];
+    }
+    // Rows of the initial content are tightly packed, whatever the width of the texture
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, mCacheWidth, mCacheHeight, 0, GL_RED, GL_UNSIGNED_BYTE, apPixels);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
@@ -126,20 +211,106 @@ FontImpl::FontImpl(const char* apPathFilename, size_t aPixelSize, size_t aCacheS
 // Cleanup all Freetype and OpenGL ressources when the last reference is destroyed.
 FontImpl::~FontImpl() {
     hb_font_destroy(mFont);
+    if (NULL != mFace) {
+        closeFace(mFace);
+    }
     glDeleteTextures(1, &mCacheTexture);
     glDeleteVertexArrays(1, &mCacheVAO);
     glDeleteBuffers(1, &mCacheVBO);
-    glDeleteBuffers(1, &mCacheIBO);
+}
+
+// Open a Freetype face on the font file, at the given pixel size.
+FT_Face FontImpl::openFace(size_t aPixelSize) const {
+    Freetype& freetype = Freetype::getInstance();
+    std::lock_guard<std::mutex> lock(freetype.getMutex());
+    // Read the font from the memory of the font file, without copying it
+    FT_Face face = NULL;
+    FT_Error error = FT_New_Memory_Face(freetype.getLibrary(), mFontFile->getData(),
+                                        static_cast<FT_Long>(mFontFile->getSize()),
+                                        static_cast<FT_Long>(mFontFile->getFaceIndex()), &face);
+    if (error) {
+        throw Exception("FT_New_Memory_Face error");
+    }
+    // Set the vertical pixel size
+    error = FT_Set_Pixel_Sizes(face, 0, static_cast<FT_UInt>(aPixelSize));
+    if (error) {
+        FT_Done_Face(face);
+        throw Exception("FT_Set_Pixel_Sizes error");
+    }
+    return face;
+}
+
+// Close a Freetype face opened by openFace().
+void FontImpl::closeFace(FT_Face apFace) {
+    Freetype& freetype = Freetype::getInstance();
+    std::lock_guard<std::mutex> lock(freetype.getMutex());
+    FT_Done_Face(apFace);
+}
+
+// Create a HarfBuzz font on the shared face of the font file, using the given Freetype face.
+hb_font_t* FontImpl::createFont(FT_Face apFace) const {
+    hb_font_t* font = hb_font_create(mFontFile->getFace());
+    hb_ft_font_set_funcs_for_face(font, apFace);
+    // Give the pixel size to HarfBuzz, the same way as hb_ft_font_create()
+    const FT_Size_Metrics& metrics = apFace->size->metrics;
+    const uint64_t upem = apFace->units_per_EM;
+    hb_font_set_scale(font,
+                      static_cast<int>((static_cast<uint64_t>(metrics.x_scale) * upem + (1 << 15)) >> 16),
+                      static_cast<int>((static_cast<uint64_t>(metrics.y_scale) * upem + (1 << 15)) >> 16));
+    hb_font_set_ppem(font, metrics.x_ppem, metrics.y_ppem);
+    return font;
+}
+
+// Precompile the HarfBuzz shaping plan of the given text segment properties, and cache it into the face.
+void FontImpl::prepare(const ShapingPlan& aShapingPlan) {
+    // Empty properties are guessed the same way as assemble() does, by hb_buffer_guess_segment_properties()
+    hb_segment_properties_t props = HB_SEGMENT_PROPERTIES_DEFAULT;
+    if (!aShapingPlan.script.empty()) {
+        props.script = hb_script_from_string(aShapingPlan.script.c_str(), -1);
+        if (HB_SCRIPT_UNKNOWN == props.script) {
+            throw Exception("prepare: unknown script " + aShapingPlan.script);
+        }
+    }
+    if (!aShapingPlan.language.empty()) {
+        props.language = hb_language_from_string(aShapingPlan.language.c_str(), -1);
+    } else {
+        props.language = hb_language_get_default();
+    }
+    if (!aShapingPlan.direction.empty()) {
+        props.direction = hb_direction_from_string(aShapingPlan.direction.c_str(), -1);
+        if (HB_DIRECTION_INVALID == props.direction) {
+            throw Exception("prepare: invalid direction " + aShapingPlan.direction);
+        }
+    } else {
+        props.direction = hb_script_get_horizontal_direction(props.script);
+    }
+    std::vector<hb_feature_t> features(aShapingPlan.features.size());
+    for (size_t i = 0; i < features.size(); ++i) {
+        if (!hb_feature_from_string(aShapingPlan.features[i].c_str(), -1, &features[i])) {
+            throw Exception("prepare: invalid feature " + aShapingPlan.features[i]);
+        }
+    }
+
+    // The face keeps its own reference to the cached plan
+    hb_shape_plan_t* plan = hb_shape_plan_create_cached(hb_font_get_face(mFont), &props,
+                                                        features.empty() ? NULL : &features[0], features.size(), NULL);
+    hb_shape_plan_destroy(plan);
 }
 
 // Pre-render and cache the glyphs representing the given characters, to speed-up future rendering.
 float FontImpl::cache(const std::string& aCharacters) {
     std::cout << "FontImpl::cache(" << aCharacters << ")\n";
 
+    // All the glyphs of a bitmap font are already in the cache
+    if (NULL == mFont) {
+        return usage();
+    }
+
     // Put the provided UTF-8 encoded characters into a Harfbuzz buffer
     hb_buffer_t* buffer = hb_buffer_create();
-    hb_buffer_set_direction(buffer, HB_DIRECTION_LTR);
     hb_buffer_add_utf8(buffer, aCharacters.c_str(), aCharacters.size(), 0, aCharacters.size());
+    // with the same script, direction and language as assemble() would use
+    hb_buffer_guess_segment_properties(buffer);
     // Ask Harfbuzz to shape the UTF-8 buffer
     hb_shape(mFont, buffer, NULL, 0);
 
@@ -227,25 +398,25 @@ void FontImpl::cache(FT_UInt codepoint) {
     int offsetX = mFace->glyph->bitmap_left;
     int offsetY = mFace->glyph->bitmap_top - bitmap.rows; // Can be negative
 
-    glyphVerticies.bl.x = static_cast<float>(offsetX);
-    glyphVerticies.bl.y = static_cast<float>(offsetY);
-    glyphVerticies.bl.s = mCacheFreeSlotX/static_cast<float>(mCacheWidth);
-    glyphVerticies.bl.t = (mCacheFreeSlotY + bitmap.rows)/static_cast<float>(mCacheHeight);
+    glyphVerticies.bl.x = toPosition(offsetX);
+    glyphVerticies.bl.y = toPosition(offsetY);
+    glyphVerticies.bl.s = toTexCoord(mCacheFreeSlotX, mCacheWidth);
+    glyphVerticies.bl.t = toTexCoord(mCacheFreeSlotY + bitmap.rows, mCacheHeight);
 
-    glyphVerticies.br.x = static_cast<float>(offsetX + bitmap.width);
-    glyphVerticies.br.y = static_cast<float>(offsetY);
-    glyphVerticies.br.s = (mCacheFreeSlotX + bitmap.width)/static_cast<float>(mCacheWidth);
-    glyphVerticies.br.t = (mCacheFreeSlotY + bitmap.rows)/static_cast<float>(mCacheHeight);
+    glyphVerticies.br.x = toPosition(offsetX + bitmap.width);
+    glyphVerticies.br.y = toPosition(offsetY);
+    glyphVerticies.br.s = toTexCoord(mCacheFreeSlotX + bitmap.width, mCacheWidth);
+    glyphVerticies.br.t = toTexCoord(mCacheFreeSlotY + bitmap.rows, mCacheHeight);
 
-    glyphVerticies.tl.x = static_cast<float>(offsetX);
-    glyphVerticies.tl.y = static_cast<float>(offsetY + bitmap.rows);
-    glyphVerticies.tl.s = mCacheFreeSlotX/static_cast<float>(mCacheWidth);
-    glyphVerticies.tl.t = mCacheFreeSlotY/static_cast<float>(mCacheHeight);
+    glyphVerticies.tl.x = toPosition(offsetX);
+    glyphVerticies.tl.y = toPosition(offsetY + bitmap.rows);
+    glyphVerticies.tl.s = toTexCoord(mCacheFreeSlotX, mCacheWidth);
+    glyphVerticies.tl.t = toTexCoord(mCacheFreeSlotY, mCacheHeight);
 
-    glyphVerticies.tr.x = static_cast<float>(offsetX + bitmap.width);
-    glyphVerticies.tr.y = static_cast<float>(offsetY + bitmap.rows);
-    glyphVerticies.tr.s = (mCacheFreeSlotX + bitmap.width)/static_cast<float>(mCacheWidth);
-    glyphVerticies.tr.t = mCacheFreeSlotY/static_cast<float>(mCacheHeight);
+    glyphVerticies.tr.x = toPosition(offsetX + bitmap.width);
+    glyphVerticies.tr.y = toPosition(offsetY + bitmap.rows);
+    glyphVerticies.tr.s = toTexCoord(mCacheFreeSlotX + bitmap.width, mCacheWidth);
+    glyphVerticies.tr.t = toTexCoord(mCacheFreeSlotY, mCacheHeight);
 
     // Cache vertices and indices into a vector (that is, by index of insertion)
     mCacheGlyphVertList.push_back(glyphVerticies);
@@ -275,34 +446,134 @@ float FontImpl::usage() const {
 }
 
 // Assemble data from cached glyphs to represent the given string of characters, and put them on a VAO.
-Text FontImpl::assemble(const std::string& aCharacters, const std::shared_ptr<const FontImpl>& aFontImplPtr) const {
+Text FontImpl::assemble(const std::string& aCharacters, hb_language_t aLanguage, size_t& aPositionX, bool abInstanced,
+                        const std::shared_ptr<const FontImpl>& aFontImplPtr) const {
     std::cout << "FontImpl::render(" << aCharacters << ")\n";
 
+    GlyphVertVector vertVector;
+    shape(mFont, aCharacters, aLanguage, aPositionX, vertVector);
+
+    return abInstanced ? uploadInstanced(vertVector, aFontImplPtr) : upload(vertVector, aFontImplPtr);
+}
+
+// Assemble data from cached glyphs for many strings at once, shaping them on worker threads.
+std::vector<Text> FontImpl::assembleBatch(const std::vector<std::string>&      aStrings,
+                                          const std::shared_ptr<const FontImpl>& aFontImplPtr) const {
+    std::cout << "FontImpl::assembleBatch(" << aStrings.size() << " strings)\n";
+
+    // Use one worker per core, but never more workers than strings to shape
+    size_t nbWorkers = std::thread::hardware_concurrency();
+    if (nbWorkers > aStrings.size()) {
+        nbWorkers = aStrings.size();
+    }
+
+    // Laying out a bitmap font is too cheap to be worth any thread
+    std::vector<GlyphVertVector> vertVectors(aStrings.size());
+    if ((nbWorkers <= 1) || (NULL == mFont)) {
+        for (size_t i = 0; i < aStrings.size(); ++i) {
+            size_t positionX = 0;
+            shape(mFont, aStrings[i], HB_LANGUAGE_INVALID, positionX, vertVectors[i]);
+        }
+    } else {
+        // Each worker shapes with its own HarfBuzz font (and its own Freetype face) sharing the same HarfBuzz face,
+        // as neither a hb_font_t nor a FT_Face can be used from multiple threads simultaneously.
+        std::vector<FT_Face> workerFaces;
+        std::vector<hb_font_t*> workerFonts;
+        try {
+            for (size_t w = 0; w < nbWorkers; ++w) {
+                workerFaces.push_back(openFace(mFace->size->metrics.y_ppem));
+                workerFonts.push_back(createFont(workerFaces.back()));
+            }
+        } catch (...) {
+            for (size_t w = 0; w < workerFonts.size(); ++w) {
+                hb_font_destroy(workerFonts[w]);
+            }
+            for (size_t w = 0; w < workerFaces.size(); ++w) {
+                closeFace(workerFaces[w]);
+            }
+            throw;
+        }
+
+        // Strings are distributed in an interleaved way, and any exception is transported back to the calling thread
+        std::vector<std::exception_ptr> workerErrors(nbWorkers);
+        std::vector<std::thread> workers;
+        try {
+            // Reserve first, so that no thread is ever left joinable in a temporary if the vector had to grow
+            workers.reserve(nbWorkers);
+            for (size_t w = 0; w < nbWorkers; ++w) {
+                workers.push_back(std::thread([this, w, nbWorkers, &aStrings, &vertVectors, &workerFonts,
+                                               &workerErrors]() {
+                    try {
+                        for (size_t i = w; i < aStrings.size(); i += nbWorkers) {
+                            size_t positionX = 0;
+                            shape(workerFonts[w], aStrings[i], HB_LANGUAGE_INVALID, positionX, vertVectors[i]);
+                        }
+                    } catch (...) {
+                        workerErrors[w] = std::current_exception();
+                    }
+                }));
+            }
+        } catch (...) {
+            // A thread could not be started: wait for the ones already running before releasing their fonts
+            for (size_t w = 0; w < workers.size(); ++w) {
+                workers[w].join();
+            }
+            for (size_t w = 0; w < nbWorkers; ++w) {
+                hb_font_destroy(workerFonts[w]);
+                closeFace(workerFaces[w]);
+            }
+            throw;
+        }
+        for (size_t w = 0; w < nbWorkers; ++w) {
+            workers[w].join();
+            hb_font_destroy(workerFonts[w]);
+            closeFace(workerFaces[w]);
+        }
+        for (size_t w = 0; w < nbWorkers; ++w) {
+            if (workerErrors[w]) {
+                std::rethrow_exception(workerErrors[w]);
+            }
+        }
+    }
+
+    // Then load all the data into the GPU, in a single pass on the calling thread (the one owning the OpenGL context)
+    std::vector<Text> texts;
+    texts.reserve(aStrings.size());
+    for (size_t i = 0; i < aStrings.size(); ++i) {
+        texts.push_back(upload(vertVectors[i], aFontImplPtr));
+    }
+
+    return texts;
+}
+
+// Shape the given string of characters, and fill a vector with the cached glyph data used to represent it.
+void FontImpl::shape(hb_font_t* apFont, const std::string& aCharacters, hb_language_t aLanguage, size_t& aPositionX,
+                     GlyphVertVector& aVertVector) const {
+    // A bitmap font has no Harfbuzz font
+    if (NULL == apFont) {
+        layout(aCharacters, aPositionX, aVertVector);
+        return;
+    }
+
     // Put the provided UTF-8 encoded characters into a Harfbuzz buffer
     hb_buffer_t* buffer = hb_buffer_create();
-    hb_buffer_set_direction(buffer, HB_DIRECTION_LTR);
+    hb_buffer_set_language(buffer, aLanguage);
     hb_buffer_add_utf8(buffer, aCharacters.c_str(), aCharacters.size(), 0, aCharacters.size());
+    // Guess the script from the characters, its direction, and the language of the current locale if none is given
+    // (HarfBuzz then outputs right-to-left texts in visual order, ready to be laid out from left to right)
+    hb_buffer_guess_segment_properties(buffer);
     // Ask Harfbuzz to shape the UTF-8 buffer
-    hb_shape(mFont, buffer, NULL, 0);
+    hb_shape(apFont, buffer, NULL, 0);
 
     // Get buffer properties
     size_t textLength = hb_buffer_get_length(buffer);
     hb_glyph_info_t* glyphs = hb_buffer_get_glyph_infos(buffer, 0);
     hb_glyph_position_t* positions = hb_buffer_get_glyph_positions(buffer, 0);
 
-    // Cache texture, used only to render & cache new characters
-    glActiveTexture(GL_TEXTURE0 + _TextureUnitIdx);
-    glBindTexture(GL_TEXTURE_2D, mCacheTexture);
-    // Affects the unpacking of pixel data from memory. Specifies the alignment requirements
-    // for the start of each pixel row in memory; 1 for byte-alignment (See also GL_UNPACK_ROW_LENGTH).
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-    GL_CHECK();
-
-    // Temporary vectors to fill with cached glyph data (vertex and indices) to load VBO/IBO into the GPU
-    GlyphVertVector vertVector(textLength);
-    GlyphIdxVector  idxVector(textLength);
+    // Vector to fill with cached glyph data (vertex) to load VBO into the GPU
+    aVertVector.resize(textLength);
 
-    size_t positionX = 0;
+    size_t positionX = aPositionX;
     size_t positionY = 0;
 
     // Iterate over the glyphs of the text
@@ -316,66 +587,230 @@ Text FontImpl::assemble(const std::string& aCharacters, const std::shared_ptr<co
             idxInCache = iGlyph->second;
         } else {
             // if not in cache, throws
+            hb_buffer_destroy(buffer);
             throw Exception("assemble: missing glyph from the cache");
         }
 
-        // Use cache to fill a VBO and a VBI, and a VAO
-        vertVector[i].bl.x = mCacheGlyphVertList[idxInCache].bl.x + positionX + positions[i].x_offset;
-        vertVector[i].bl.y = mCacheGlyphVertList[idxInCache].bl.y + positionY + positions[i].y_offset;
-        vertVector[i].bl.s = mCacheGlyphVertList[idxInCache].bl.s;
-        vertVector[i].bl.t = mCacheGlyphVertList[idxInCache].bl.t;
-
-        vertVector[i].br.x = mCacheGlyphVertList[idxInCache].br.x + positionX + positions[i].x_offset;
-        vertVector[i].br.y = mCacheGlyphVertList[idxInCache].br.y + positionY + positions[i].y_offset;
-        vertVector[i].br.s = mCacheGlyphVertList[idxInCache].br.s;
-        vertVector[i].br.t = mCacheGlyphVertList[idxInCache].br.t;
-
-        vertVector[i].tl.x = mCacheGlyphVertList[idxInCache].tl.x + positionX + positions[i].x_offset;
-        vertVector[i].tl.y = mCacheGlyphVertList[idxInCache].tl.y + positionY + positions[i].y_offset;
-        vertVector[i].tl.s = mCacheGlyphVertList[idxInCache].tl.s;
-        vertVector[i].tl.t = mCacheGlyphVertList[idxInCache].tl.t;
-
-        vertVector[i].tr.x = mCacheGlyphVertList[idxInCache].tr.x + positionX + positions[i].x_offset;
-        vertVector[i].tr.y = mCacheGlyphVertList[idxInCache].tr.y + positionY + positions[i].y_offset;
-        vertVector[i].tr.s = mCacheGlyphVertList[idxInCache].tr.s;
-        vertVector[i].tr.t = mCacheGlyphVertList[idxInCache].tr.t;
-
-        // Calculate vertex indicies
-        size_t idxOffset = i * 4;
-        idxVector[i].bl1 = 0 + idxOffset;
-        idxVector[i].br1 = 1 + idxOffset;
-        idxVector[i].tl1 = 2 + idxOffset;
-        idxVector[i].br2 = 1 + idxOffset;
-        idxVector[i].tl2 = 2 + idxOffset;
-        idxVector[i].tr2 = 3 + idxOffset;
+        // Use cache to fill a VBO
+        aVertVector[i] = mCacheGlyphVertList[idxInCache];
+        try {
+            move(aVertVector[i], static_cast<int>(positionX) + positions[i].x_offset,
+                                 static_cast<int>(positionY) + positions[i].y_offset);
+        } catch (...) {
+            hb_buffer_destroy(buffer);
+            throw;
+        }
 
         // Advance the position (">> 6" is the standard freetype formulae)
         positionX += (positions[i].x_advance >> 6);
     }
+    aPositionX = positionX;
+
+    hb_buffer_destroy(buffer);
+}
+
+// Lay out the glyphs of a bitmap font one after the other, with the kerning pairs of the font.
+void FontImpl::layout(const std::string& aCharacters, size_t& aPositionX, GlyphVertVector& aVertVector) const {
+    aVertVector.clear();
+    aVertVector.reserve(aCharacters.size());
+
+    int positionX = static_cast<int>(aPositionX);
+    FT_UInt previous = 0;
+    size_t offset = 0;
+    while (offset < aCharacters.size()) {
+        size_t next;
+        const FT_UInt codepoint = decodeUtf8(aCharacters, offset, next);
+        offset = next;
+
+        GlyphIdxMap::const_iterator iGlyph = mCacheGlyphIdxMap.find(codepoint);
+        if (mCacheGlyphIdxMap.end() == iGlyph) {
+            throw Exception("assemble: missing glyph from the bitmap font");
+        }
+        if (!mKerningMap.empty()) {
+            KerningMap::const_iterator iKerning = mKerningMap.find(std::make_pair(previous, codepoint));
+            if (mKerningMap.end() != iKerning) {
+                positionX += iKerning->second;
+            }
+        }
+
+        // Use cache to fill a VBO
+        GlyphVerticies glyphVerticies = mCacheGlyphVertList[iGlyph->second];
+        move(glyphVerticies, positionX, 0);
+        aVertVector.push_back(glyphVerticies);
+
+        positionX += mCacheGlyphAdvanceList[iGlyph->second];
+        previous = codepoint;
+    }
+    aPositionX = (positionX > 0) ? static_cast<size_t>(positionX) : 0;
+}
+
+// Get the list of all the characters supported by this Font.
+void FontImpl::getCodepoints(std::vector<uint32_t>& aCodepoints) const {
+    aCodepoints.clear();
+    if (NULL != mFace) {
+        // Walk the Unicode character map of the Freetype face
+        FT_UInt glyphIndex;
+        FT_ULong charcode = FT_Get_First_Char(mFace, &glyphIndex);
+        while (0 != glyphIndex) {
+            aCodepoints.push_back(static_cast<uint32_t>(charcode));
+            charcode = FT_Get_Next_Char(mFace, charcode, &glyphIndex);
+        }
+    } else {
+        // Glyphs of a bitmap font are indexed by their Unicode codepoint
+        GlyphIdxMap::const_iterator iGlyph;
+        for (iGlyph = mCacheGlyphIdxMap.begin(); iGlyph != mCacheGlyphIdxMap.end(); ++iGlyph) {
+            aCodepoints.push_back(iGlyph->first);
+        }
+    }
+}
+
+#ifdef GLTEXT_COMPACT_VERTICES
+static const GLenum     _PositionType = GL_SHORT;               ///< Vertex coordinates are 16 bits integers
+static const GLenum     _TexCoordType = GL_UNSIGNED_SHORT;      ///< Texture coordinates are 16 bits integers...
+static const GLboolean  _TexCoordNormalized = GL_TRUE;          ///< ...normalized to [0.0f; 1.0f] when fetched
+#else
+static const GLenum     _PositionType = GL_FLOAT;               ///< Vertex coordinates are floats
+static const GLenum     _TexCoordType = GL_FLOAT;               ///< Texture coordinates are floats...
+static const GLboolean  _TexCoordNormalized = GL_FALSE;         ///< ...already in the range [0.0f; 1.0f]
+#endif
+
+// Convert a vertex coordinate, in pixels, to the vertex format.
+FontImpl::PositionType FontImpl::toPosition(int aPixels) {
+#ifdef GLTEXT_COMPACT_VERTICES
+    if ((aPixels < std::numeric_limits<GLshort>::min()) || (aPixels > std::numeric_limits<GLshort>::max())) {
+        throw Exception("assemble: text too large for the compact vertex format");
+    }
+#endif
+    return static_cast<PositionType>(aPixels);
+}
+
+// Convert a texel coordinate in the cache texture to the vertex format.
+FontImpl::TexCoordType FontImpl::toTexCoord(size_t aTexels, size_t aSize) {
+#ifdef GLTEXT_COMPACT_VERTICES
+    // Rounded to the nearest of the 65536 normalized values: off by up to aSize/131070 texel,
+    // so linear filtering can give slightly different pixels than the float vertex format
+    return static_cast<TexCoordType>((aTexels * 65535 + aSize / 2) / aSize);
+#else
+    return aTexels/static_cast<TexCoordType>(aSize);
+#endif
+}
+
+// Move the 4 vertices of a glyph by the given offset, in pixels.
+void FontImpl::move(GlyphVerticies& aVerticies, int aOffsetX, int aOffsetY) {
+    aVerticies.bl.x = toPosition(static_cast<int>(aVerticies.bl.x) + aOffsetX);
+    aVerticies.bl.y = toPosition(static_cast<int>(aVerticies.bl.y) + aOffsetY);
+    aVerticies.br.x = toPosition(static_cast<int>(aVerticies.br.x) + aOffsetX);
+    aVerticies.br.y = toPosition(static_cast<int>(aVerticies.br.y) + aOffsetY);
+    aVerticies.tl.x = toPosition(static_cast<int>(aVerticies.tl.x) + aOffsetX);
+    aVerticies.tl.y = toPosition(static_cast<int>(aVerticies.tl.y) + aOffsetY);
+    aVerticies.tr.x = toPosition(static_cast<int>(aVerticies.tr.x) + aOffsetX);
+    aVerticies.tr.y = toPosition(static_cast<int>(aVerticies.tr.y) + aOffsetY);
+}
+
+// Get the size of the four vertices of a glyph, in bytes.
+size_t FontImpl::getGlyphVerticiesSize() {
+    return sizeof(GlyphVerticies);
+}
+
+// Get the size of the instance record of a glyph, in bytes.
+size_t FontImpl::getGlyphInstanceSize() {
+    return sizeof(GlyphInstance);
+}
+
+// Describe the vertex format to the current Vertex Array Object, for the GlyphVertex of the bound VBO.
+void FontImpl::setVertexAttribs(const Program& aProgram) {
+    glEnableVertexAttribArray(aProgram.mVertexPositionAttrib);
+    glEnableVertexAttribArray(aProgram.mVertexTextureCoordAttrib);
+    glVertexAttribPointer(aProgram.mVertexPositionAttrib, 2, _PositionType, GL_FALSE, sizeof(GlyphVertex),
+                          reinterpret_cast<GLvoid*>(offsetof(GlyphVertex, x)));
+    glVertexAttribPointer(aProgram.mVertexTextureCoordAttrib, 2, _TexCoordType, _TexCoordNormalized,
+                          sizeof(GlyphVertex), reinterpret_cast<GLvoid*>(offsetof(GlyphVertex, s)));
+}
+
+// Describe the instance format to the current Vertex Array Object, for the GlyphInstance of the bound VBO.
+void FontImpl::setInstanceAttribs(const Program& aProgram) {
+    glEnableVertexAttribArray(aProgram.mInstancedGlyphRectAttrib);
+    glEnableVertexAttribArray(aProgram.mInstancedAtlasRectAttrib);
+    glVertexAttribPointer(aProgram.mInstancedGlyphRectAttrib, 4, _PositionType, GL_FALSE, sizeof(GlyphInstance),
+                          reinterpret_cast<GLvoid*>(offsetof(GlyphInstance, x0)));
+    glVertexAttribPointer(aProgram.mInstancedAtlasRectAttrib, 4, _TexCoordType, _TexCoordNormalized,
+                          sizeof(GlyphInstance), reinterpret_cast<GLvoid*>(offsetof(GlyphInstance, s0)));
+    glVertexAttribDivisor(aProgram.mInstancedGlyphRectAttrib, 1);
+    glVertexAttribDivisor(aProgram.mInstancedAtlasRectAttrib, 1);
+}
+
+// Load the glyph data of a shaped string into OpenGL buffers, and give their ownership to a new Text.
+Text FontImpl::upload(const GlyphVertVector& aVertVector, const std::shared_ptr<const FontImpl>& aFontImplPtr) const {
+    const size_t textLength = aVertVector.size();
+
+    // Most texts share the VAO and the VBO of a block of the arena, only their slice of the VBO being loaded
+    if (textLength <= VertexArena::BLOCK_GLYPHS) {
+        VertexArena::Slice* pSlice = VertexArena::getInstance()->allocate(textLength);
+        if (0 < textLength) {
+            glBindBuffer(GL_ARRAY_BUFFER, pSlice->pBlock->vbo);
+            glBufferSubData(GL_ARRAY_BUFFER, pSlice->offset * sizeof(GlyphVerticies),
+                            textLength * sizeof(GlyphVerticies), &aVertVector[0]);
+            GL_CHECK();
+        }
+        return Text(std::shared_ptr<TextImpl>(new TextImpl(aFontImplPtr, pSlice)));
+    }
 
     // Generate data for a Text object
     Program& program = Program::getInstance();
     glUseProgram(program.mProgram);
     GLuint textVAO;                    ///< Vertex Array Object used to render a text
     GLuint textVBO;                    ///< Vertex Buffer Object used to render a text
-    GLuint textIBO;                    ///< Index Buffer Object used to render a text
     glGenVertexArrays(1, &textVAO);
     glGenBuffers(1, &textVBO);
-    glGenBuffers(1, &textIBO);
     glBindVertexArray(textVAO);
     glBindBuffer(GL_ARRAY_BUFFER, textVBO);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, textIBO);
-    // Load data into the GPU
-    glBufferData(GL_ARRAY_BUFFER,         textLength * sizeof(GlyphVerticies), &vertVector[0], GL_STATIC_DRAW);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, textLength * sizeof(GlyphIndices),   &idxVector[0], GL_STATIC_DRAW);
-    glEnableVertexAttribArray(program.mVertexPositionAttrib);
-    glEnableVertexAttribArray(program.mVertexTextureCoordAttrib);
-    glVertexAttribPointer(program.mVertexPositionAttrib, 2, GL_FLOAT, GL_FALSE, sizeof(GlyphVertex), 0);
-    glVertexAttribPointer(program.mVertexTextureCoordAttrib, 2, GL_FLOAT, GL_FALSE, sizeof(GlyphVertex), reinterpret_cast<GLvoid*>(sizeof(GlyphVertex)/2)); // NOLINT
+    // Indices are always the same for the glyphs of any text, so they are shared in a single growing buffer
+    const GLenum indexType = QuadIndexBuffer::getInstance().bind(textLength);
+    // Load data into the GPU (an empty string gives an empty buffer)
+    glBufferData(GL_ARRAY_BUFFER, textLength * sizeof(GlyphVerticies),
+                 textLength ? &aVertVector[0] : NULL, GL_STATIC_DRAW);
+    setVertexAttribs(program);
     GL_CHECK();
 
     // Then give ownership of those data to a new dedicated Text object
-    return Text(aFontImplPtr, textLength, textVAO, textVBO, textIBO);
+    return Text(aFontImplPtr, textLength, textVAO, textVBO, indexType);
+}
+
+// Load the glyph data of a shaped string as one instance per glyph, and give its ownership to a new Text.
+Text FontImpl::uploadInstanced(const GlyphVertVector&                  aVertVector,
+                               const std::shared_ptr<const FontImpl>&  aFontImplPtr) const {
+    const size_t textLength = aVertVector.size();
+
+    // Glyph quads are axis aligned: their bottom left and top right corners are enough to describe them
+    GlyphInstVector instVector(textLength);
+    for (size_t i = 0; i < textLength; ++i) {
+        instVector[i].x0 = aVertVector[i].bl.x;
+        instVector[i].y0 = aVertVector[i].bl.y;
+        instVector[i].x1 = aVertVector[i].tr.x;
+        instVector[i].y1 = aVertVector[i].tr.y;
+        instVector[i].s0 = aVertVector[i].bl.s;
+        instVector[i].t0 = aVertVector[i].bl.t;
+        instVector[i].s1 = aVertVector[i].tr.s;
+        instVector[i].t1 = aVertVector[i].tr.t;
+    }
+
+    // Generate data for a Text object, with attributes advancing once per instance (that is, per glyph)
+    Program& program = Program::getInstance();
+    glUseProgram(program.mInstancedProgram);
+    GLuint textVAO;                    ///< Vertex Array Object used to render a text
+    GLuint textVBO;                    ///< Vertex Buffer Object used to render a text
+    glGenVertexArrays(1, &textVAO);
+    glGenBuffers(1, &textVBO);
+    glBindVertexArray(textVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, textVBO);
+    // Load data into the GPU (an empty string gives an empty buffer)
+    glBufferData(GL_ARRAY_BUFFER, textLength * sizeof(GlyphInstance),
+                 textLength ? &instVector[0] : NULL, GL_STATIC_DRAW);
+    setInstanceAttribs(program);
+    GL_CHECK();
+
+    // Then give ownership of those data to a new dedicated Text object, without any index
+    return Text(aFontImplPtr, textLength, textVAO, textVBO, 0, true);
 }
 
 // Draw the cache texture for debug purpose.
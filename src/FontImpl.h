@@ -9,18 +9,23 @@
  */
 #pragma once
 
+#include <gltext/Font.h>
 #include <gltext/Text.h>
 
 #include <string>
 #include <map>
+#include <utility>
 #include <vector>
 
 #include <hb-ft.h>      // HarfBuzz Freetype interface
 
 #include "glload.hpp"   // OpenGL types & function pointers
+#include "FontFile.h"   // NOLINT TODO
+#include "BMFont.h"     // NOLINT TODO
 
 namespace gltext {
 
+class Program;
 
 /**
  * @brief Private Implementation of the Freetype / HarfBuzz Font rendering.
@@ -31,20 +36,27 @@ namespace gltext {
  * from the inclusion of Freetype and HarfBuzz libraries.
  */
 class FontImpl {
-    // TODO : replace by a getter for mCacheTexture
-    friend class TextImpl;
-
 public:
     /**
      * @brief Ask Freetype to open a Font file and initialize it with the given size
      *
      * @see Font::Font() for detailed explanation
      *
-     * @param[in] apPathFilename    Path to the OpenType font file to open with Freetype.
+     * @param[in] aFontFile         Font file, opened from disk or already in memory, shared with other Fonts.
      * @param[in] aPixelSize        Vertical size of the font in pixel
      * @param[in] aCacheSize        Minimum number of characters to allocate into the cache (use a square value).
+     * @param[in] aShapingPlans     List of text segment properties for which to precompile the shaping plans.
      */
-    FontImpl(const char* apPathFilename, size_t aPixelSize, size_t aCacheSize);
+    FontImpl(const std::shared_ptr<FontFile>& aFontFile, size_t aPixelSize, size_t aCacheSize,
+             const std::vector<ShapingPlan>& aShapingPlans);
+    /**
+     * @brief Load all the glyphs of a prebuilt bitmap font into the cache, without Freetype nor HarfBuzz.
+     *
+     * @see Font::loadBMFont() for detailed explanation
+     *
+     * @param[in] aBMFont   Descriptor of the bitmap font, its page images being loaded into the cache texture.
+     */
+    explicit FontImpl(const BMFont& aBMFont);
     /**
      * @brief Cleanup all Freetype and OpenGL ressources when the last reference is destroyed.
      */
@@ -67,11 +79,28 @@ public:
      * @see Font::assemble() for detailed explanation
      *
      * @param[in] aCharacters   UTF-8 encoded string of characters to pre-render and add to the cache.
+     * @param[in] aLanguage     Language of the text (HB_LANGUAGE_INVALID to use the one of the current locale).
+     * @param[in,out] aPositionX  Horizontal pen position of the first glyph, advanced past the last one.
+     * @param[in] abInstanced   Store one instance per glyph instead of the four vertices of its quad.
      * @param[in] aFontImplPtr  Shared pointer to this Private Implementation.
      *
      * @return Encapsulation of the constant text rendered with Freetype, ready to be drawn with OpenGL.
      */
-    Text assemble(const std::string& aCharacters, const std::shared_ptr<const FontImpl>& aFontImplPtr) const;
+    Text assemble(const std::string& aCharacters, hb_language_t aLanguage, size_t& aPositionX, bool abInstanced,
+                  const std::shared_ptr<const FontImpl>& aFontImplPtr) const;
+
+    /**
+     * @brief Assemble data from cached glyphs for many strings at once, shaping them on worker threads.
+     *
+     * @see Font::assembleBatch() for detailed explanation
+     *
+     * @param[in] aStrings      List of UTF-8 encoded strings of characters to assemble.
+     * @param[in] aFontImplPtr  Shared pointer to this Private Implementation.
+     *
+     * @return List of the constant texts rendered with Freetype, in the same order as the provided strings.
+     */
+    std::vector<Text> assembleBatch(const std::vector<std::string>&         aStrings,
+                                    const std::shared_ptr<const FontImpl>&  aFontImplPtr) const;
 
     /**
      * @brief Draw the cache texture for debug purpose.
@@ -86,7 +115,88 @@ public:
      */
     void drawCache(float aOffsetX, float aOffsetY, float aScaleX, float aScaleY) const;
 
+    /**
+     * @brief Get the list of all the characters supported by this Font.
+     *
+     * @param[out] aCodepoints  Unicode codepoints of the characters of the Freetype character map or of the bitmap font.
+     */
+    void getCodepoints(std::vector<uint32_t>& aCodepoints) const;
+
+    /**
+     * @brief Get the 2D Texture used to cache the rendered glyphs, to draw texts assembled from this font.
+     */
+    inline GLuint getCacheTexture() const {
+        return mCacheTexture;
+    }
+
+    /**
+     * @brief Get the size of the four vertices of a glyph, in bytes.
+     */
+    static size_t getGlyphVerticiesSize();
+
+    /**
+     * @brief Get the size of the instance record of a glyph, in bytes.
+     */
+    static size_t getGlyphInstanceSize();
+
+    /**
+     * @brief Describe the vertex format to the current Vertex Array Object, for the GlyphVertex of the bound VBO.
+     *
+     * @param[in] aProgram  Shaders program singleton.
+     */
+    static void setVertexAttribs(const Program& aProgram);
+
+    /**
+     * @brief Describe the instance format to the current Vertex Array Object, for the GlyphInstance of the bound VBO.
+     *
+     * @param[in] aProgram  Shaders program singleton.
+     */
+    static void setInstanceAttribs(const Program& aProgram);
+
 private:
+    /**
+     * @brief Open a Freetype face on the font file, at the given pixel size.
+     *
+     *  The face is opened on the library of the Freetype singleton, and must be closed with closeFace().
+     *
+     * @param[in] aPixelSize    Vertical size of the font in pixels.
+     *
+     * @throw a gltext::Exception if the face cannot be opened.
+     */
+    FT_Face openFace(size_t aPixelSize) const;
+
+    /**
+     * @brief Close a Freetype face opened by openFace().
+     *
+     * @param[in] apFace        Freetype face to close, after all HarfBuzz fonts using it have been destroyed.
+     */
+    static void closeFace(FT_Face apFace);
+
+    /**
+     * @brief Create a HarfBuzz font on the shared face of the font file, using the given Freetype face.
+     *
+     * @param[in] apFace        Freetype face opened by openFace(), outliving the HarfBuzz font.
+     *
+     * @return New HarfBuzz font, to be destroyed with hb_font_destroy()
+     */
+    hb_font_t* createFont(FT_Face apFace) const;
+
+    /**
+     * @brief Precompile the HarfBuzz shaping plan of the given text segment properties, and cache it into the face.
+     *
+     * @param[in] aShapingPlan  Text segment properties for which to precompile the shaping plan.
+     *
+     * @warning Throws if a property cannot be parsed by HarfBuzz.
+     */
+    void prepare(const ShapingPlan& aShapingPlan);
+
+    /**
+     * @brief Create the cache texture, and the vertex buffer used for its debug draw.
+     *
+     * @param[in] apPixels  Initial content of the texture, mCacheWidth x mCacheHeight bytes (NULL for transparent).
+     */
+    void initCache(const GLubyte* apPixels);
+
     /**
      * @brief Pre-render and cache the glyph representing the given unicode Unicode codepoint.
      *
@@ -102,12 +212,24 @@ private:
     float usage() const;
 
 private:
+#ifdef GLTEXT_COMPACT_VERTICES
+    /// Vertex coordinate, in pixels (the CMake option GLTEXT_COMPACT_VERTICES gives 8 bytes vertices)
+    typedef GLshort     PositionType;
+    /// Texture coordinate, normalized from [0; 65535] to [0.0f; 1.0f] when fetched by the vertex shader (rounded)
+    typedef GLushort    TexCoordType;
+#else
+    /// Vertex coordinate, in pixels
+    typedef GLfloat     PositionType;
+    /// Texture coordinate, in the range [0.0f; 1.0f]
+    typedef GLfloat     TexCoordType;
+#endif
+
     /// Data of one of four glyph vertex
     struct GlyphVertex {
-        GLfloat x;  ///< Vertex x coordinate
-        GLfloat y;  ///< Vertex y coordinate
-        GLfloat s;  ///< Texture s (x) coordinate
-        GLfloat t;  ///< Texture t (y) coordinate
+        PositionType x; ///< Vertex x coordinate
+        PositionType y; ///< Vertex y coordinate
+        TexCoordType s; ///< Texture s (x) coordinate
+        TexCoordType t; ///< Texture t (y) coordinate
     };
 
     /// Vertex and texture coordinates of the 4 corners of a glyph (that is, a quad, or 2 triangles)
@@ -118,25 +240,109 @@ private:
         GlyphVertex tr; ///< Vertex data of the Top Right corner
     };
 
-    /// Corresponding 6 indices used to described the 2 triangles that compose a glyph
-    struct GlyphIndices {
-        GLushort bl1;   ///< Index 0 of the vertex in the Bottom Left corner (first triangle)
-        GLushort br1;   ///< Index 1 of the vertex in the Bottom Right corner (first triangle)
-        GLushort tl1;   ///< Index 2 of the vertex in the Top Left corner (first triangle)
-        GLushort br2;   ///< Index 1 of the vertex in the Bottom Right corner (second triangle)
-        GLushort tr2;   ///< Index 2 of the vertex in the Top Right corner (second triangle)
-        GLushort tl2;   ///< Index 3 of the vertex in the Top Left corner (second triangle)
+    /// Screen and texture rectangles of a glyph, expanded into its quad by the vertex shader (one instance per glyph)
+    struct GlyphInstance {
+        PositionType x0;    ///< Left x coordinate
+        PositionType y0;    ///< Bottom y coordinate
+        PositionType x1;    ///< Right x coordinate
+        PositionType y1;    ///< Top y coordinate
+        TexCoordType s0;    ///< Left texture s (x) coordinate
+        TexCoordType t0;    ///< Bottom texture t (y) coordinate
+        TexCoordType s1;    ///< Right texture s (x) coordinate
+        TexCoordType t1;    ///< Top texture t (y) coordinate
     };
 
     /// Association of codepoint/idx of the cached glyphs
     typedef std::map<FT_UInt, size_t>   GlyphIdxMap;
     /// Vector of cached vertex and texture coordinates for each glyph
     typedef std::vector<GlyphVerticies> GlyphVertVector;
-    /// Vector of cached indices for each glyph
-    typedef std::vector<GlyphIndices>   GlyphIdxVector;
+    /// Vector of instance data for each glyph
+    typedef std::vector<GlyphInstance>  GlyphInstVector;
+    /// Horizontal adjustment of the pen position between two characters of a bitmap font
+    typedef std::map<std::pair<FT_UInt, FT_UInt>, int>  KerningMap;
+
+private:
+    /**
+     * @brief Convert a vertex coordinate, in pixels, to the vertex format.
+     *
+     * @warning Throws if the coordinate is out of the range of the compact vertex format.
+     */
+    static PositionType toPosition(int aPixels);
+
+    /**
+     * @brief Convert a texel coordinate in the cache texture to the vertex format.
+     *
+     * @param[in] aTexels   Coordinate in the cache texture, in texels.
+     * @param[in] aSize     Size of the cache texture along the same axis, in texels.
+     */
+    static TexCoordType toTexCoord(size_t aTexels, size_t aSize);
+
+    /**
+     * @brief Move the 4 vertices of a glyph by the given offset, in pixels.
+     *
+     * @warning Throws if a coordinate gets out of the range of the compact vertex format.
+     */
+    static void move(GlyphVerticies& aVerticies, int aOffsetX, int aOffsetY);
+
+    /**
+     * @brief Shape the given string of characters, and fill a vector with the cached glyph data used to represent it.
+     *
+     *  Does not use OpenGL nor modify the cache, so it can be called from multiple threads simultaneously,
+     * as long as each thread uses its own HarfBuzz font.
+     *
+     * @param[in]  apFont       HarfBuzz font to use for text shaping.
+     * @param[in]  aCharacters  UTF-8 encoded string of characters to shape.
+     * @param[in]  aLanguage    Language of the text (HB_LANGUAGE_INVALID to use the one of the current locale,
+     *                          as set by hb_buffer_guess_segment_properties() along with the script and direction).
+     * @param[in,out] aPositionX  Horizontal pen position of the first glyph, advanced past the last one.
+     * @param[out] aVertVector  Vertex and texture coordinates of each glyph of the text.
+     *
+     * @warning Throws if any characters is missing from cache.
+     */
+    void shape(hb_font_t* apFont, const std::string& aCharacters, hb_language_t aLanguage, size_t& aPositionX,
+               GlyphVertVector& aVertVector) const;
+
+    /**
+     * @brief Lay out the glyphs of a bitmap font one after the other, with the kerning pairs of the font.
+     *
+     *  Used by shape() instead of HarfBuzz for a bitmap font. Can be called from multiple threads simultaneously.
+     *
+     * @param[in]  aCharacters  UTF-8 encoded string of characters to lay out.
+     * @param[in,out] aPositionX  Horizontal pen position of the first glyph, advanced past the last one.
+     * @param[out] aVertVector  Vertex and texture coordinates of each glyph of the text.
+     *
+     * @warning Throws if any characters is missing from the font.
+     */
+    void layout(const std::string& aCharacters, size_t& aPositionX, GlyphVertVector& aVertVector) const;
+
+    /**
+     * @brief Load the glyph data of a shaped string into OpenGL buffers, and give their ownership to a new Text.
+     *
+     *  The glyphs are indexed by the QuadIndexBuffer shared by all texts. Their vertices are loaded into a slice
+     * of the VertexArena, or into new dedicated buffers for texts longer than VertexArena::BLOCK_GLYPHS glyphs.
+     *
+     * @param[in] aVertVector   Vertex and texture coordinates of each glyph of the text.
+     * @param[in] aFontImplPtr  Shared pointer to this Private Implementation.
+     *
+     * @return Encapsulation of the constant text rendered with Freetype, ready to be drawn with OpenGL.
+     */
+    Text upload(const GlyphVertVector& aVertVector, const std::shared_ptr<const FontImpl>& aFontImplPtr) const;
+
+    /**
+     * @brief Load the glyph data of a shaped string as one instance per glyph, and give its ownership to a new Text.
+     *
+     *  Only the screen and texture rectangles of each glyph are stored, without any index buffer:
+     * the quads are expanded by the vertex shader of the instanced program.
+     *
+     * @param[in] aVertVector   Vertex and texture coordinates of each glyph of the text.
+     * @param[in] aFontImplPtr  Shared pointer to this Private Implementation.
+     *
+     * @return Encapsulation of the constant text rendered with Freetype, ready to be drawn with OpenGL.
+     */
+    Text uploadInstanced(const GlyphVertVector& aVertVector, const std::shared_ptr<const FontImpl>& aFontImplPtr) const;
 
 private:
-    std::string     mPathFilename;      ///< Path to the OpenType font file to open with Freetype.
+    std::shared_ptr<FontFile> mFontFile; ///< Font file, with the HarfBuzz face, shared by all Font opened on it.
     size_t          mCacheWidth;        ///< Horizontal size of the cache texture.
     size_t          mCacheHeight;       ///< Vertical size  of the cache texture.
     size_t          mCacheLineHeight;   ///< Vertical size of the current line of character cache in pixel.
@@ -144,15 +350,16 @@ private:
     size_t          mCacheFreeSlotY;    ///< Y coordinate of next free slot on the cache texture.
     GlyphIdxMap     mCacheGlyphIdxMap;  ///< Association of codepoint/idx of the cached glyphs
     GlyphVertVector mCacheGlyphVertList; ///< List of cached data (vertex and texture coordinates, and indices)
+    std::vector<int> mCacheGlyphAdvanceList; ///< Horizontal advance of each cached glyph (bitmap font only)
+    KerningMap      mKerningMap;        ///< Kerning pairs of the characters (bitmap font only)
 
-    FT_Face         mFace;              ///< Handle to typographic face object (given typeface/font, in a given style).
-    hb_font_t*      mFont;              ///< Harfbuzz pointer to the freetype font, for text shaping
+    FT_Face         mFace;              ///< Freetype face at the pixel size of this Font (NULL for a bitmap font).
+    hb_font_t*      mFont;              ///< Harfbuzz pointer to the freetype font, for text shaping (NULL for bitmap)
 
     GLuint mCacheTexture;               ///< 2D Texture used to cache the rendered glyphs, shared between multiple Text
     // For cache debug draw
     GLuint mCacheVAO;                   ///< Vertex Array Object used only for debug draw of the cache
     GLuint mCacheVBO;                   ///< Vertex Buffer Object used only for debug draw of the cache
-    GLuint mCacheIBO;                   ///< Index Buffer Object used only for debug draw of the cache
 };
 
 } // namespace gltext
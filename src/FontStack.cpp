@@ -0,0 +1,73 @@
+/**
+ * @file    FontStack.cpp
+ * @brief   Ordered list of fonts, each character of a text being rendered with the first font supporting it.
+ *
+ * Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <gltext/FontStack.h>
+
+#include "FontStackImpl.h"  // NOLINT TODO
+#include "Exception.h"      // NOLINT TODO
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+namespace gltext {
+
+const size_t FontStack::NOT_FOUND;
+
+// Build the index of the characters supported by each of the given fonts.
+FontStack::FontStack(const std::vector<Font>& aFonts) {
+    if (aFonts.empty()) {
+        throw Exception("FontStack: empty list of fonts");
+    }
+    if (aFonts.size() > FontStackImpl::MAX_FONTS) {
+        throw Exception("FontStack: too many fonts");
+    }
+    std::vector<std::shared_ptr<FontImpl> > fontImpls;
+    fontImpls.reserve(aFonts.size());
+    for (size_t i = 0; i < aFonts.size(); ++i) {
+        fontImpls.push_back(aFonts[i].mImplPtr);
+    }
+    mImplPtr.reset(new FontStackImpl(fontImpls));
+}
+
+// Release the references to the fonts.
+FontStack::~FontStack() {
+    // mImplPtr release its reference to the FontStackImpl instance
+}
+
+// Get the index of the first font supporting the given character.
+size_t FontStack::getFontIndex(unsigned int aCodepoint) const {
+    assert(mImplPtr);
+
+    return mImplPtr->getFontIndex(aCodepoint);
+}
+
+// Pre-render and cache the glyphs representing the given characters, each one into the font supporting it.
+float FontStack::cache(const std::string& aCharacters) {
+    assert(mImplPtr);
+
+    return mImplPtr->cache(aCharacters);
+}
+
+// Assemble data from cached glyphs to represent the given string of characters, one Text per font run.
+std::vector<Text> FontStack::assemble(const std::string& aCharacters) const {
+    assert(mImplPtr);
+
+    return mImplPtr->assemble(aCharacters, HB_LANGUAGE_INVALID);
+}
+
+// Assemble data from cached glyphs to represent the given string of characters in the given language.
+std::vector<Text> FontStack::assemble(const std::string& aCharacters, const Language& aLanguage) const {
+    assert(mImplPtr);
+
+    return mImplPtr->assemble(aCharacters, static_cast<hb_language_t>(aLanguage.mHandle));
+}
+
+} // namespace gltext
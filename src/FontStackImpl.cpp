@@ -0,0 +1,189 @@
+/**
+ * @file    FontStackImpl.cpp
+ * @brief   Private Implementation of the font fallback chain.
+ *
+ * Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "FontStackImpl.h"  // NOLINT TODO
+#include "Utf8.h"           // NOLINT TODO
+
+#include <string>
+#include <vector>
+
+namespace gltext {
+
+const size_t FontStackImpl::MAX_FONTS;
+const uint8_t FontStackImpl::NO_FONT;
+
+// Build the index of the characters supported by each of the given fonts.
+FontStackImpl::FontStackImpl(const std::vector<std::shared_ptr<FontImpl> >& aFontImpls) :
+    mFontImpls(aFontImpls),
+    mCoverages(aFontImpls.size()) {
+    std::vector<uint32_t> codepoints;
+    for (size_t i = 0; i < mFontImpls.size(); ++i) {
+        // Allocate the bitmap of a plane on its first character
+        mFontImpls[i]->getCodepoints(codepoints);
+        for (size_t c = 0; c < codepoints.size(); ++c) {
+            const uint32_t codepoint = codepoints[c];
+            if (codepoint <= 0x10FFFF) {
+                std::vector<uint32_t>& plane = mCoverages[i].planes[codepoint >> 16];
+                if (plane.empty()) {
+                    plane.resize(65536 / 32, 0);
+                }
+                plane[(codepoint & 0xFFFF) >> 5] |= (1u << (codepoint & 31));
+
+                // Fonts are walked in order, so only the first one supporting the character gets its index
+                std::vector<uint8_t>& fontIndexes = mFontIndexes[codepoint >> 16];
+                if (fontIndexes.empty()) {
+                    fontIndexes.resize(65536, NO_FONT);
+                }
+                uint8_t& fontIndex = fontIndexes[codepoint & 0xFFFF];
+                if (NO_FONT == fontIndex) {
+                    fontIndex = static_cast<uint8_t>(i);
+                }
+            }
+        }
+    }
+}
+
+// Get the index of the first font supporting the given character.
+size_t FontStackImpl::getFontIndex(hb_codepoint_t aCodepoint) const {
+    if (aCodepoint > 0x10FFFF) {
+        return FontStack::NOT_FOUND;
+    }
+    const std::vector<uint8_t>& fontIndexes = mFontIndexes[aCodepoint >> 16];
+    if (fontIndexes.empty() || (NO_FONT == fontIndexes[aCodepoint & 0xFFFF])) {
+        return FontStack::NOT_FOUND;
+    }
+    return fontIndexes[aCodepoint & 0xFFFF];
+}
+
+// Pre-render and cache the glyphs of each run of the given characters into its font.
+float FontStackImpl::cache(const std::string& aCharacters) {
+    std::vector<Run> runs;
+    split(aCharacters, runs);
+
+    // Each run is cached on its own, as shaping it with its neighbours could select other glyphs
+    float usage = 0.0f;
+    for (size_t r = 0; r < runs.size(); ++r) {
+        const std::string run = aCharacters.substr(runs[r].begin, runs[r].end - runs[r].begin);
+        const float runUsage = mFontImpls[runs[r].font]->cache(run);
+        if (usage < runUsage) {
+            usage = runUsage;
+        }
+    }
+
+    return usage;
+}
+
+// Assemble data from cached glyphs of each run of the given characters.
+std::vector<Text> FontStackImpl::assemble(const std::string& aCharacters, hb_language_t aLanguage) const {
+    std::vector<Run> runs;
+    split(aCharacters, runs);
+
+    // HarfBuzz outputs the glyphs of a right-to-left run in visual order, but each group of consecutive right-to-left
+    // runs must also be laid out from its last run to its first one
+    std::vector<std::string> runCharacters(runs.size());
+    std::vector<bool> bRightToLeft(runs.size());
+    for (size_t r = 0; r < runs.size(); ++r) {
+        runCharacters[r] = aCharacters.substr(runs[r].begin, runs[r].end - runs[r].begin);
+        bRightToLeft[r] = isRightToLeft(runCharacters[r]);
+    }
+    std::vector<size_t> visualOrder;
+    visualOrder.reserve(runs.size());
+    for (size_t r = 0; r < runs.size(); ) {
+        size_t end = r + 1;
+        if (bRightToLeft[r]) {
+            while ((end < runs.size()) && bRightToLeft[end]) {
+                ++end;
+            }
+        }
+        for (size_t v = end; v > r; --v) {
+            visualOrder.push_back(v - 1);
+        }
+        r = end;
+    }
+
+    // Each run starts where the previous one ended on screen, but the texts are returned in logical order
+    std::vector<Text> visualTexts;
+    visualTexts.reserve(runs.size());
+    std::vector<size_t> visualIndexes(runs.size());
+    size_t positionX = 0;
+    for (size_t v = 0; v < visualOrder.size(); ++v) {
+        const size_t r = visualOrder[v];
+        const std::shared_ptr<FontImpl>& fontImplPtr = mFontImpls[runs[r].font];
+        visualTexts.push_back(fontImplPtr->assemble(runCharacters[r], aLanguage, positionX, false, fontImplPtr));
+        visualIndexes[r] = v;
+    }
+    std::vector<Text> texts;
+    texts.reserve(runs.size());
+    for (size_t r = 0; r < runs.size(); ++r) {
+        texts.push_back(visualTexts[visualIndexes[r]]);
+    }
+
+    return texts;
+}
+
+// Tell if the given run of characters is written from right to left, as guessed by HarfBuzz when shaping it.
+bool FontStackImpl::isRightToLeft(const std::string& aCharacters) {
+    hb_buffer_t* buffer = hb_buffer_create();
+    hb_buffer_add_utf8(buffer, aCharacters.c_str(), aCharacters.size(), 0, aCharacters.size());
+    hb_buffer_guess_segment_properties(buffer);
+    const bool bRightToLeft = (HB_DIRECTION_RTL == hb_buffer_get_direction(buffer));
+    hb_buffer_destroy(buffer);
+    return bRightToLeft;
+}
+
+// Split the given string of characters into runs of consecutive characters using the same font.
+void FontStackImpl::split(const std::string& aCharacters, std::vector<Run>& aRuns) const {
+    hb_unicode_funcs_t* pUnicode = hb_unicode_funcs_get_default();
+
+    aRuns.clear();
+    size_t offset = 0;
+    while (offset < aCharacters.size()) {
+        size_t next;
+        const hb_codepoint_t codepoint = decodeUtf8(aCharacters, offset, next);
+
+        // Combining marks, joiners, variation selectors and spaces stay with the current font if it supports them,
+        // so that they are shaped with their base character, and so that spaces do not break runs
+        bool bAttached = false;
+        if (!aRuns.empty() && mCoverages[aRuns.back().font].has(codepoint)) {
+            switch (hb_unicode_general_category(pUnicode, codepoint)) {
+            case HB_UNICODE_GENERAL_CATEGORY_NON_SPACING_MARK:
+            case HB_UNICODE_GENERAL_CATEGORY_SPACING_MARK:
+            case HB_UNICODE_GENERAL_CATEGORY_ENCLOSING_MARK:
+            case HB_UNICODE_GENERAL_CATEGORY_FORMAT:
+            case HB_UNICODE_GENERAL_CATEGORY_SPACE_SEPARATOR:
+                bAttached = true;
+                break;
+            default:
+                break;
+            }
+        }
+
+        // Otherwise use the first font supporting the character, or keep the current one if none does
+        size_t font;
+        if (bAttached) {
+            font = aRuns.back().font;
+        } else {
+            font = getFontIndex(codepoint);
+            if (FontStack::NOT_FOUND == font) {
+                font = aRuns.empty() ? 0 : aRuns.back().font;
+            }
+        }
+
+        if (!aRuns.empty() && (aRuns.back().font == font)) {
+            aRuns.back().end = next;
+        } else {
+            Run run = {font, offset, next};
+            aRuns.push_back(run);
+        }
+        offset = next;
+    }
+}
+
+} // namespace gltext
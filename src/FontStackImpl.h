@@ -0,0 +1,108 @@
+/**
+ * @file    FontStackImpl.h
+ * @brief   Private Implementation of the font fallback chain.
+ *
+ * Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <gltext/FontStack.h>
+
+#include <string>
+#include <vector>
+
+#include "FontImpl.h"   // NOLINT TODO
+
+namespace gltext {
+
+/**
+ * @brief Private Implementation of the font fallback chain.
+ *
+ * @see the FontStack class for detailed explanation
+ */
+class FontStackImpl {
+public:
+    /// Maximum number of fonts, as the index of the first font supporting a character is stored on a byte
+    static const size_t MAX_FONTS = 255;
+
+    /**
+     * @brief Build the index of the characters supported by each of the given fonts.
+     *
+     * @param[in] aFontImpls    Ordered list of fonts, from the preferred to the last resort one (at least one).
+     */
+    explicit FontStackImpl(const std::vector<std::shared_ptr<FontImpl> >& aFontImpls);
+
+    /**
+     * @brief Get the index of the first font supporting the given character.
+     *
+     * @see FontStack::getFontIndex() for detailed explanation
+     */
+    size_t getFontIndex(hb_codepoint_t aCodepoint) const;
+
+    /**
+     * @brief Pre-render and cache the glyphs of each run of the given characters into its font.
+     *
+     * @see FontStack::cache() for detailed explanation
+     */
+    float cache(const std::string& aCharacters);
+
+    /**
+     * @brief Assemble data from cached glyphs of each run of the given characters.
+     *
+     * @see FontStack::assemble() for detailed explanation
+     */
+    std::vector<Text> assemble(const std::string& aCharacters, hb_language_t aLanguage) const;
+
+private:
+    /// Characters supported by a font: a bitmap of the codepoints of each Unicode plane, empty if none is supported
+    struct Coverage {
+        std::vector<uint32_t>   planes[17]; ///< 2048 words (65536 bits) per supported plane
+
+        /// Is the given codepoint supported ?
+        inline bool has(hb_codepoint_t aCodepoint) const {
+            if (aCodepoint > 0x10FFFF) {
+                return false;
+            }
+            const std::vector<uint32_t>& plane = planes[aCodepoint >> 16];
+            return !plane.empty() && (0 != (plane[(aCodepoint & 0xFFFF) >> 5] & (1u << (aCodepoint & 31))));
+        }
+    };
+
+    /// Run of consecutive characters using the same font
+    struct Run {
+        size_t  font;   ///< Index of the font
+        size_t  begin;  ///< Offset of the first byte of the run in the UTF-8 string
+        size_t  end;    ///< Offset past the last byte of the run in the UTF-8 string
+    };
+
+    /**
+     * @brief Split the given string of characters into runs of consecutive characters using the same font.
+     *
+     * @param[in]  aCharacters  UTF-8 encoded string of characters to split.
+     * @param[out] aRuns        Runs of the text, in logical order.
+     */
+    void split(const std::string& aCharacters, std::vector<Run>& aRuns) const;
+
+    /**
+     * @brief Tell if the given run of characters is written from right to left, as guessed by HarfBuzz when shaping it.
+     *
+     * @param[in] aCharacters   UTF-8 encoded string of characters of the run.
+     *
+     * @return true if the script of the run is written from right to left.
+     */
+    static bool isRightToLeft(const std::string& aCharacters);
+
+private:
+    /// Value of mFontIndexes for a character supported by none of the fonts
+    static const uint8_t NO_FONT = 0xFF;
+
+    std::vector<std::shared_ptr<FontImpl> > mFontImpls;  ///< Ordered list of the fonts
+    std::vector<Coverage>                   mCoverages;  ///< Characters supported by each font
+    std::vector<uint8_t>    mFontIndexes[17];  ///< Index of the first font supporting each codepoint of each plane
+                                               ///< (65536 bytes per plane supported by any font, empty otherwise)
+};
+
+} // namespace gltext
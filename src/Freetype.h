@@ -11,14 +11,16 @@
 
 #include <hb-ft.h>  // HarfBuzz Freetype interface
 
+#include <mutex>    // NOLINT TODO
+
 namespace gltext {
 
 /**
  * @brief Singleton to interface the Freetype library
  *
- *  Using a singleton is simple but has drawbacks; it must not be used from multiple threads simultaneously.
- * So we have to do all Font loading, rendering and caching in one thread, and use only the Text result
- * in other threads.
+ *  All the Freetype faces of the Fonts are opened on this library. Freetype does not allow faces to be created
+ * nor destroyed on the same library from multiple threads simultaneously, so it must only be done with
+ * getMutex() locked. Each face can then be used without locking, from one thread at a time.
  */
 class Freetype {
 public:
@@ -37,19 +39,25 @@ public:
      */
     inline const FT_Library& getLibrary() const;
 
+    /**
+     * @brief Access the mutex to lock while creating or destroying a face on the Freetype library.
+     */
+    inline std::mutex& getMutex();
+
     /**
      * @brief Access instance of the singleton to the Freetype library
      *
      * @return The unique static instance of this interface
      */
     static inline Freetype& getInstance() {
-        /// Static instance of the singleton
-        static Freetype _freetypeInstance;
-        return _freetypeInstance;
+        /// Static instance of the singleton, never destroyed so that Fonts can close their face at any time at exit
+        static Freetype* _pFreetypeInstance = new Freetype();
+        return *_pFreetypeInstance;
     }
 
 private:
     FT_Library  mLibrary;   ///< Handle to the Freetype Library
+    std::mutex  mMutex;     ///< Mutex serializing the creation and destruction of faces on the library
 };
 
 // Access the handle to the Freetype library.
@@ -57,4 +65,9 @@ inline const FT_Library& Freetype::getLibrary() const {
     return mLibrary;
 }
 
+// Access the mutex to lock while creating or destroying a face on the Freetype library.
+inline std::mutex& Freetype::getMutex() {
+    return mMutex;
+}
+
 } // namespace gltext
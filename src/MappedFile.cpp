@@ -0,0 +1,94 @@
+/**
+ * @file    MappedFile.cpp
+ * @brief   Read-only memory mapping of a whole file.
+ *
+ * Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "MappedFile.h" // NOLINT TODO
+#include "Exception.h"  // NOLINT TODO
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <string>
+
+namespace gltext {
+
+#ifdef _WIN32
+
+// Map the whole content of the given file in memory.
+MappedFile::MappedFile(const char* apPathFilename) :
+    mpData(NULL),
+    mSize(0) {
+    HANDLE file = CreateFileA(apPathFilename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (INVALID_HANDLE_VALUE == file) {
+        throw Exception(std::string("CreateFile error: ") + apPathFilename);
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || (0 == size.QuadPart)) {
+        CloseHandle(file);
+        throw Exception(std::string("empty or unreadable file: ") + apPathFilename);
+    }
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (NULL == mapping) {
+        throw Exception(std::string("CreateFileMapping error: ") + apPathFilename);
+    }
+    // The view keeps the mapping alive, so its handle is not needed anymore
+    mpData = static_cast<const unsigned char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    CloseHandle(mapping);
+    if (NULL == mpData) {
+        throw Exception(std::string("MapViewOfFile error: ") + apPathFilename);
+    }
+    mSize = static_cast<size_t>(size.QuadPart);
+}
+
+// Unmap the file.
+MappedFile::~MappedFile() {
+    UnmapViewOfFile(mpData);
+}
+
+#else // _WIN32
+
+// Map the whole content of the given file in memory.
+MappedFile::MappedFile(const char* apPathFilename) :
+    mpData(NULL),
+    mSize(0) {
+    int fd = open(apPathFilename, O_RDONLY);
+    if (-1 == fd) {
+        throw Exception(std::string("open error: ") + apPathFilename);
+    }
+    struct stat status;
+    if ((-1 == fstat(fd, &status)) || (0 == status.st_size)) {
+        close(fd);
+        throw Exception(std::string("empty or unreadable file: ") + apPathFilename);
+    }
+    // The mapping stays valid after the file descriptor is closed
+    void* pData = mmap(NULL, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (MAP_FAILED == pData) {
+        throw Exception(std::string("mmap error: ") + apPathFilename);
+    }
+    mpData = static_cast<const unsigned char*>(pData);
+    mSize = static_cast<size_t>(status.st_size);
+}
+
+// Unmap the file.
+MappedFile::~MappedFile() {
+    munmap(const_cast<unsigned char*>(mpData), mSize);
+}
+
+#endif // _WIN32
+
+} // namespace gltext
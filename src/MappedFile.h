@@ -0,0 +1,61 @@
+/**
+ * @file    MappedFile.h
+ * @brief   Read-only memory mapping of a whole file.
+ *
+ * Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <cstddef>
+
+namespace gltext {
+
+/**
+ * @brief Read-only memory mapping of a whole file (mmap() on POSIX systems, MapViewOfFile() on Windows).
+ *
+ *  Used to load fonts without copying them: the mapping is read in place both by Freetype and by HarfBuzz,
+ * so pages of the file are only loaded by the OS when first accessed.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Map the whole content of the given file in memory.
+     *
+     * @param[in] apPathFilename    Path to the file to map.
+     *
+     * @throw a gltext::Exception if the file cannot be opened or mapped, or is empty.
+     */
+    explicit MappedFile(const char* apPathFilename);
+    /**
+     * @brief Unmap the file.
+     */
+    ~MappedFile();
+
+    /**
+     * @brief Access the content of the file.
+     */
+    inline const unsigned char* getData() const {
+        return mpData;
+    }
+    /**
+     * @brief Size of the file, in bytes.
+     */
+    inline size_t getSize() const {
+        return mSize;
+    }
+
+private:
+    /// Non copyable: the mapping is owned by the object.
+    MappedFile(const MappedFile&);
+    /// Non copyable: the mapping is owned by the object.
+    MappedFile& operator=(const MappedFile&);
+
+private:
+    const unsigned char*    mpData; ///< Start of the mapped content of the file.
+    size_t                  mSize;  ///< Size of the file, in bytes.
+};
+
+} // namespace gltext
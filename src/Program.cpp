@@ -81,6 +81,77 @@ static const char* _fragmentShaderSource =
 "    outputColor = vec4(color*textureIntensity, textureIntensity);\n"
 "}\n";
 
+/// Source of the vertex shader used to draw a TextBatch: each vertex is moved to the position of its text
+static const char* _batchVertexShaderSource =
+"#version 330\n"
+"\n"
+"// Attributes (input data streams ; 2D vertex position and texture coordinates, position and color of the text)\n"
+"layout(location = 0) in vec2 position;\n"
+"layout(location = 1) in vec2 texCoord;\n"
+"layout(location = 2) in vec2 textPosition;\n"
+"layout(location = 3) in vec3 textColor;\n"
+"\n"
+"// Output data streams (smoothed interpolated texture 2D coordinates, and constant color of the text)\n"
+"smooth out vec2 smoothTexCoord;\n"
+"flat out vec3 flatColor;\n"
+"\n"
+"// Uniform variables\n"
+"uniform vec2 scale;\n"
+"uniform vec2 offset;\n"
+"\n"
+"void main() {\n"
+"    // positions are moved to their text position, then scaled and offseted\n"
+"    gl_Position = vec4((position + textPosition + offset) * scale, 0.0f, 1.0f);\n"
+"    smoothTexCoord = texCoord;\n"
+"    flatColor = textColor;\n"
+"}\n";
+
+/// Source of the fragment shader used to draw a TextBatch using the cache texture
+static const char* _batchFragmentShaderSource =
+"#version 330\n"
+"\n"
+"smooth in vec2 smoothTexCoord;\n"
+"flat in vec3 flatColor;\n"
+"\n"
+"out vec4 outputColor;\n"
+"\n"
+"uniform sampler2D textureCache;\n"
+"\n"
+"void main() {\n"
+"    // Texture gives only grayed ('black & white') intensity onto the 'GL_RED' color component\n"
+"    float textureIntensity = texture(textureCache, smoothTexCoord).r;\n"
+"    // Texture intensity is composed with the color of the text, and also drives the alpha component\n"
+"    outputColor = vec4(flatColor*textureIntensity, textureIntensity);\n"
+"}\n";
+
+/// Source of the vertex shader used to draw instanced glyphs: the quad of each glyph is expanded from its rectangles
+static const char* _instancedVertexShaderSource =
+"#version 330\n"
+"\n"
+"// Attributes (one instance per glyph ; screen and texture rectangles, position and color of the text)\n"
+"layout(location = 0) in vec4 glyphRect;\n"
+"layout(location = 1) in vec4 atlasRect;\n"
+"layout(location = 2) in vec2 textPosition;\n"
+"layout(location = 3) in vec3 textColor;\n"
+"\n"
+"// Output data streams (smoothed interpolated texture 2D coordinates, and constant color of the text)\n"
+"smooth out vec2 smoothTexCoord;\n"
+"flat out vec3 flatColor;\n"
+"\n"
+"// Uniform variables\n"
+"uniform vec2 scale;\n"
+"uniform vec2 offset;\n"
+"\n"
+"void main() {\n"
+"    // the 4 vertices of the triangle strip are the bottom left, bottom right, top left and top right corners\n"
+"    vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);\n"
+"    vec2 position = mix(glyphRect.xy, glyphRect.zw, corner);\n"
+"    // positions are moved to their text position, then scaled and offseted\n"
+"    gl_Position = vec4((position + textPosition + offset) * scale, 0.0f, 1.0f);\n"
+"    smoothTexCoord = mix(atlasRect.xy, atlasRect.zw, corner);\n"
+"    flatColor = textColor;\n"
+"}\n";
+
 
 Program::Program() {
     std::cout << "Program::Program()\n";
@@ -103,6 +174,34 @@ Program::Program() {
     GLuint textureCacheUnif = glGetUniformLocation(mProgram, "textureCache");
     glUniform1i(textureCacheUnif, _TextureUnitIdx);
     GL_CHECK();
+
+    // Same for the program used to draw a TextBatch
+    GLuint batchVertexShader = compileShader(GL_VERTEX_SHADER, _batchVertexShaderSource);
+    GLuint batchFragmentShader = compileShader(GL_FRAGMENT_SHADER, _batchFragmentShaderSource);
+    mBatchProgram = linkProgram(batchVertexShader, batchFragmentShader);
+    glUseProgram(mBatchProgram);
+    mBatchTextPositionAttrib = glGetAttribLocation(mBatchProgram, "textPosition");
+    mBatchTextColorAttrib = glGetAttribLocation(mBatchProgram, "textColor");
+    mBatchScaleUnif = glGetUniformLocation(mBatchProgram, "scale");
+    mBatchOffsetUnif = glGetUniformLocation(mBatchProgram, "offset");
+    textureCacheUnif = glGetUniformLocation(mBatchProgram, "textureCache");
+    glUniform1i(textureCacheUnif, _TextureUnitIdx);
+    GL_CHECK();
+
+    // Same for the program used to draw instanced glyphs, sharing the fragment shader of the TextBatch
+    GLuint instancedVertexShader = compileShader(GL_VERTEX_SHADER, _instancedVertexShaderSource);
+    GLuint instancedFragmentShader = compileShader(GL_FRAGMENT_SHADER, _batchFragmentShaderSource);
+    mInstancedProgram = linkProgram(instancedVertexShader, instancedFragmentShader);
+    glUseProgram(mInstancedProgram);
+    mInstancedGlyphRectAttrib = glGetAttribLocation(mInstancedProgram, "glyphRect");
+    mInstancedAtlasRectAttrib = glGetAttribLocation(mInstancedProgram, "atlasRect");
+    mInstancedTextPositionAttrib = glGetAttribLocation(mInstancedProgram, "textPosition");
+    mInstancedTextColorAttrib = glGetAttribLocation(mInstancedProgram, "textColor");
+    mInstancedScaleUnif = glGetUniformLocation(mInstancedProgram, "scale");
+    mInstancedOffsetUnif = glGetUniformLocation(mInstancedProgram, "offset");
+    textureCacheUnif = glGetUniformLocation(mInstancedProgram, "textureCache");
+    glUniform1i(textureCacheUnif, _TextureUnitIdx);
+    GL_CHECK();
 }
 
 Program::~Program() {
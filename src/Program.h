@@ -88,6 +88,20 @@ public:
     GLuint mScaleUnif;                  ///< uniform location of the "scale" variable
     GLuint mOffsetUnif;                 ///< uniform location of the "offset" variable
     GLuint mColorUnif;                  ///< uniform location of the "color" variable
+
+    GLuint mBatchProgram;               ///< program used to draw a TextBatch (same vertex position & texture coord)
+    GLuint mBatchTextPositionAttrib;    ///< position of the text of each vertex
+    GLuint mBatchTextColorAttrib;       ///< color of the text of each vertex
+    GLuint mBatchScaleUnif;             ///< uniform location of the "scale" variable of the batch program
+    GLuint mBatchOffsetUnif;            ///< uniform location of the "offset" variable of the batch program
+
+    GLuint mInstancedProgram;               ///< program used to draw instanced glyphs (one instance per glyph)
+    GLuint mInstancedGlyphRectAttrib;       ///< screen rectangle of each glyph
+    GLuint mInstancedAtlasRectAttrib;       ///< texture rectangle of each glyph in the cache
+    GLuint mInstancedTextPositionAttrib;    ///< position of the text of each glyph
+    GLuint mInstancedTextColorAttrib;       ///< color of the text of each glyph
+    GLuint mInstancedScaleUnif;             ///< uniform location of the "scale" variable of the instanced program
+    GLuint mInstancedOffsetUnif;            ///< uniform location of the "offset" variable of the instanced program
 };
 
 } // namespace gltext
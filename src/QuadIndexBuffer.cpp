@@ -0,0 +1,81 @@
+/**
+ * @file    QuadIndexBuffer.cpp
+ * @brief   Process-wide Index Buffer Object of the two triangles of each glyph quad, shared by all texts.
+ *
+ * Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "QuadIndexBuffer.h"    // NOLINT TODO
+#include "Program.h"            // NOLINT TODO
+
+#include <vector>
+
+namespace gltext {
+
+const size_t QuadIndexBuffer::MAX_SHORT_GLYPHS;
+
+/// Minimum number of glyphs indexed by a buffer, to avoid growing it for each of the first short texts
+static const size_t _MinCapacity = 256;
+
+// Constructor, creating the buffers on first use only
+QuadIndexBuffer::QuadIndexBuffer() {
+    mShortBuffer.ibo = 0;
+    mShortBuffer.capacity = 0;
+    mIntBuffer.ibo = 0;
+    mIntBuffer.capacity = 0;
+}
+
+// Destructor
+QuadIndexBuffer::~QuadIndexBuffer() {
+    // as for the Program, the OpenGL context is already gone at exit
+}
+
+// Make sure the indices of the given number of glyphs are available, and bind the buffer holding them.
+GLenum QuadIndexBuffer::bind(size_t aNbGlyphs) {
+    if (aNbGlyphs <= MAX_SHORT_GLYPHS) {
+        grow<GLushort>(mShortBuffer, aNbGlyphs, MAX_SHORT_GLYPHS);
+        return GL_UNSIGNED_SHORT;
+    } else {
+        grow<GLuint>(mIntBuffer, aNbGlyphs, static_cast<size_t>(-1) / 4);
+        return GL_UNSIGNED_INT;
+    }
+}
+
+// Grow the buffer to index at least the given number of glyphs, at least doubling its capacity.
+template<typename T>
+void QuadIndexBuffer::grow(Buffer& aBuffer, size_t aNbGlyphs, size_t aMaxGlyphs) {
+    if (0 == aBuffer.ibo) {
+        glGenBuffers(1, &aBuffer.ibo);
+    }
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, aBuffer.ibo);
+
+    if (aBuffer.capacity < aNbGlyphs) {
+        size_t capacity = (aNbGlyphs > 2 * aBuffer.capacity) ? aNbGlyphs : 2 * aBuffer.capacity;
+        if (capacity < _MinCapacity) {
+            capacity = _MinCapacity;
+        }
+        if (capacity > aMaxGlyphs) {
+            capacity = aMaxGlyphs;
+        }
+
+        // Two triangles for each glyph, sharing the vertices of the Bottom Right and Top Left corners
+        std::vector<T> indices(capacity * 6);
+        for (size_t i = 0; i < capacity; ++i) {
+            const T idxOffset = static_cast<T>(i * 4);
+            indices[i * 6 + 0] = 0 + idxOffset;
+            indices[i * 6 + 1] = 1 + idxOffset;
+            indices[i * 6 + 2] = 2 + idxOffset;
+            indices[i * 6 + 3] = 1 + idxOffset;
+            indices[i * 6 + 4] = 2 + idxOffset;
+            indices[i * 6 + 5] = 3 + idxOffset;
+        }
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(T), &indices[0], GL_STATIC_DRAW);
+        GL_CHECK();
+        aBuffer.capacity = capacity;
+    }
+}
+
+} // namespace gltext
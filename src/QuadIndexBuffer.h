@@ -0,0 +1,81 @@
+/**
+ * @file    QuadIndexBuffer.h
+ * @brief   Process-wide Index Buffer Object of the two triangles of each glyph quad, shared by all texts.
+ *
+ * Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include "glload.hpp"   // OpenGL types & function pointers
+
+namespace gltext {
+
+/**
+ * @brief Process-wide Index Buffer Object of the two triangles of each glyph quad, shared by all texts.
+ *
+ *  The indices of the glyphs of a text are always the same 0,1,2,1,2,3 pattern offset by 4 for each glyph,
+ * so a single buffer, grown on demand, serves all the Vertex Array Objects instead of one buffer per text.
+ *
+ *  16 bits indices can only address 16384 glyphs (65536 vertices), so longer texts use a second buffer
+ * of 32 bits indices. Each buffer keeps the same name when it grows, so the VAOs already bound to it stay valid.
+ *
+ *  As for any OpenGL object, it must only be used from the thread owning the OpenGL context.
+ */
+class QuadIndexBuffer {
+public:
+    /// Maximum number of glyphs that can be indexed with 16 bits indices
+    static const size_t MAX_SHORT_GLYPHS = 16384;
+
+    /**
+     * @brief Make sure the indices of the given number of glyphs are available, and bind the buffer holding them.
+     *
+     *  The buffer is bound to GL_ELEMENT_ARRAY_BUFFER, which is part of the state of the Vertex Array Object
+     * currently bound: call it after binding the VAO of the text.
+     *
+     * @param[in] aNbGlyphs Number of glyphs to be indexed.
+     *
+     * @return OpenGL type of the indices of the bound buffer (GL_UNSIGNED_SHORT or GL_UNSIGNED_INT)
+     */
+    GLenum bind(size_t aNbGlyphs);
+
+    /**
+     * @brief Get instance of the singleton
+     *
+     * @return instance of the singleton
+     */
+    static QuadIndexBuffer& getInstance() {
+        static QuadIndexBuffer buffer;
+        return buffer;
+    }
+
+private:
+    /// Constructor, creating the buffers on first use only
+    QuadIndexBuffer();
+    /// Destructor
+    ~QuadIndexBuffer();
+
+    /// An index buffer, with the number of glyphs it can index
+    struct Buffer {
+        GLuint  ibo;        ///< Index Buffer Object
+        size_t  capacity;   ///< Number of glyphs indexed by the buffer
+    };
+
+    /**
+     * @brief Grow the buffer to index at least the given number of glyphs, at least doubling its capacity.
+     *
+     * @param[in,out] aBuffer       Buffer to grow, bound to GL_ELEMENT_ARRAY_BUFFER.
+     * @param[in]     aNbGlyphs     Number of glyphs to be indexed.
+     * @param[in]     aMaxGlyphs    Maximum number of glyphs the type of indices can address.
+     */
+    template<typename T>
+    static void grow(Buffer& aBuffer, size_t aNbGlyphs, size_t aMaxGlyphs);
+
+private:
+    Buffer mShortBuffer;    ///< Buffer of 16 bits indices, for texts up to MAX_SHORT_GLYPHS glyphs
+    Buffer mIntBuffer;      ///< Buffer of 32 bits indices, for longer texts
+};
+
+} // namespace gltext
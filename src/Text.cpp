@@ -12,6 +12,7 @@
 
 #include "TextImpl.h"   // NOLINT TODO
 #include "FontImpl.h"   // NOLINT TODO
+#include "VertexArena.h"    // NOLINT TODO
 
 #include <cassert>
 
@@ -22,8 +23,14 @@ Text::Text(const std::shared_ptr<const FontImpl>&   aFontImplPtr,
            size_t                                   aTextLength,
            size_t                                   aTextVAO,
            size_t                                   aTextVBO,
-           size_t                                   aTextIBO) {
-    mImplPtr.reset(new TextImpl(aFontImplPtr, aTextLength, aTextVAO, aTextVBO, aTextIBO));
+           unsigned int                             aIndexType,
+           bool                                     abInstanced) {
+    mImplPtr.reset(new TextImpl(aFontImplPtr, aTextLength, aTextVAO, aTextVBO, aIndexType, abInstanced));
+}
+
+// Give a new reference to an already built Text implementation.
+Text::Text(const std::shared_ptr<TextImpl>& aImplPtr) :
+    mImplPtr(aImplPtr) {
 }
 
 // Cleanup all Freetype and OpenGL ressources when the last reference is destroyed.
@@ -39,6 +46,13 @@ void Text::setPosition(float aX, float aY, float aZ) {
     mImplPtr->setPosition(aX, aY, aZ);
 }
 
+// Set the offset and the scale converting the positions of the glyphs, in pixels, to OpenGL clip coordinates.
+void Text::setTransform(float aOffsetX, float aOffsetY, float aScaleX, float aScaleY) {
+    assert(mImplPtr);
+
+    mImplPtr->setTransform(aOffsetX, aOffsetY, aScaleX, aScaleY);
+}
+
 // Ask OpenGL to draw the pre-rendered static text, using the current binded program.
 void Text::draw() {
     assert(mImplPtr);
@@ -46,4 +60,9 @@ void Text::draw() {
     mImplPtr->draw();
 }
 
+// Defragment the vertex buffers shared by all the texts, releasing the memory left by destroyed texts.
+void Text::compact() {
+    VertexArena::getInstance()->compact();
+}
+
 } // namespace gltext
@@ -0,0 +1,59 @@
+/**
+ * @file    TextBatch.cpp
+ * @brief   Collection of many texts drawn together, with a single OpenGL draw call per cache texture.
+ *
+ * Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <gltext/TextBatch.h>
+
+#include "TextBatchImpl.h"  // NOLINT TODO
+
+#include <cassert>
+
+namespace gltext {
+
+// Create an empty batch.
+TextBatch::TextBatch() {
+    mImplPtr.reset(new TextBatchImpl());
+}
+
+// Cleanup all OpenGL ressources when the last reference is destroyed.
+TextBatch::~TextBatch() {
+    // mImplPtr release its reference to the TextBatchImpl instance
+}
+
+// Add a text to the batch, to be drawn at the given position with the given color.
+void TextBatch::add(const Text& aText, float aX, float aY, float aRed /* = 1.0f */, float aGreen /* = 1.0f */,
+                    float aBlue /* = 1.0f */) {
+    assert(mImplPtr);
+    assert(aText.mImplPtr);
+
+    mImplPtr->add(aText.mImplPtr, aX, aY, aRed, aGreen, aBlue);
+}
+
+// Remove all the texts from the batch.
+void TextBatch::clear() {
+    assert(mImplPtr);
+
+    mImplPtr->clear();
+}
+
+// Set the offset and the scale converting the positions of the texts, in pixels, to OpenGL clip coordinates.
+void TextBatch::setTransform(float aOffsetX, float aOffsetY, float aScaleX, float aScaleY) {
+    assert(mImplPtr);
+
+    mImplPtr->setTransform(aOffsetX, aOffsetY, aScaleX, aScaleY);
+}
+
+// Ask OpenGL to draw all the texts of the batch, with one draw call per cache texture.
+void TextBatch::draw() {
+    assert(mImplPtr);
+
+    mImplPtr->draw();
+}
+
+} // namespace gltext
@@ -0,0 +1,223 @@
+/**
+ * @file    TextBatchImpl.cpp
+ * @brief   Private Implementation of a collection of many texts drawn together.
+ *
+ * Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "TextBatchImpl.h"  // NOLINT TODO
+#include "TextImpl.h"       // NOLINT TODO
+#include "FontImpl.h"       // NOLINT TODO
+#include "Program.h"        // NOLINT TODO
+#include "QuadIndexBuffer.h" // NOLINT TODO
+
+#include <vector>
+
+namespace gltext {
+
+// Create an empty batch.
+TextBatchImpl::TextBatchImpl() :
+    mOffsetX(-200.0f),
+    mOffsetY(-200.0f),
+    mScaleX(1/256.0f),
+    mScaleY(1/256.0f),
+    mbDirty(false) {
+}
+
+// Cleanup all OpenGL ressources.
+TextBatchImpl::~TextBatchImpl() {
+    for (size_t s = 0; s < mStreams.size(); ++s) {
+        glDeleteVertexArrays(1, &mStreams[s].vao);
+        glDeleteBuffers(1, &mStreams[s].glyphVBO);
+        glDeleteBuffers(1, &mStreams[s].textVBO);
+    }
+}
+
+// Add a text to the batch, to be drawn at the given position with the given color.
+void TextBatchImpl::add(const std::shared_ptr<TextImpl>& aTextImplPtr,
+                        float aX, float aY, float aRed, float aGreen, float aBlue) {
+    Entry entry = {aTextImplPtr, aX, aY, aRed, aGreen, aBlue};
+    mEntries.push_back(entry);
+    mbDirty = true;
+}
+
+// Remove all the texts from the batch.
+void TextBatchImpl::clear() {
+    mEntries.clear();
+    mbDirty = true;
+}
+
+// Set the offset and the scale converting the positions of the texts, in pixels, to OpenGL clip coordinates.
+void TextBatchImpl::setTransform(float aOffsetX, float aOffsetY, float aScaleX, float aScaleY) {
+    mOffsetX = aOffsetX;
+    mOffsetY = aOffsetY;
+    mScaleX = aScaleX;
+    mScaleY = aScaleY;
+}
+
+// Ask OpenGL to draw all the texts of the batch, with one draw call per cache texture.
+void TextBatchImpl::draw() {
+    if (mbDirty) {
+        build();
+        mbDirty = false;
+    }
+
+    Program& program = Program::getInstance();
+
+    glUseProgram(program.mInstancedProgram);
+    glUniform2f(program.mInstancedOffsetUnif, mOffsetX, mOffsetY);
+    glUniform2f(program.mInstancedScaleUnif, mScaleX, mScaleY);
+    glUseProgram(program.mBatchProgram);
+    glUniform2f(program.mBatchOffsetUnif, mOffsetX, mOffsetY);
+    glUniform2f(program.mBatchScaleUnif, mScaleX, mScaleY);
+    GLuint currentProgram = program.mBatchProgram;
+
+    glActiveTexture(GL_TEXTURE0 + _TextureUnitIdx);
+    // Bind to sampler name zero == the currently bound texture's sampler state becomes active (no dedicated sampler)
+    glBindSampler(_TextureUnitIdx, 0);
+
+    // Draw each stream of glyphs with its cache texture, switching program only between quads and instances
+    for (size_t s = 0; s < mStreams.size(); ++s) {
+        const GLuint streamProgram = mStreams[s].instanced ? program.mInstancedProgram : program.mBatchProgram;
+        if (currentProgram != streamProgram) {
+            glUseProgram(streamProgram);
+            currentProgram = streamProgram;
+        }
+        glBindTexture(GL_TEXTURE_2D, mStreams[s].font->getCacheTexture());
+        glBindVertexArray(mStreams[s].vao);
+        if (mStreams[s].instanced) {
+            glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, mStreams[s].nbGlyphs);
+        } else {
+            glDrawElements(GL_TRIANGLES, mStreams[s].nbGlyphs * 6, mStreams[s].indexType, 0);
+        }
+    }
+}
+
+// Rebuild the vertex streams of all the cache textures from the texts of the batch.
+void TextBatchImpl::build() {
+    Program& program = Program::getInstance();
+
+    // Find the stream of each text, creating new streams for new cache textures
+    for (size_t s = 0; s < mStreams.size(); ++s) {
+        mStreams[s].nbGlyphs = 0;
+    }
+    std::vector<size_t> entryStreams(mEntries.size());
+    for (size_t e = 0; e < mEntries.size(); ++e) {
+        const std::shared_ptr<const FontImpl>& font = mEntries[e].text->getFontImpl();
+        const bool bInstanced = mEntries[e].text->isInstanced();
+        size_t s = 0;
+        while ((s < mStreams.size()) && ((mStreams[s].font != font) || (mStreams[s].instanced != bInstanced))) {
+            ++s;
+        }
+        if (s == mStreams.size()) {
+            Stream stream = {font, bInstanced, 0, 0, 0, 0, 0, 0};
+            glGenVertexArrays(1, &stream.vao);
+            glGenBuffers(1, &stream.glyphVBO);
+            glGenBuffers(1, &stream.textVBO);
+            glBindVertexArray(stream.vao);
+            if (bInstanced) {
+                // One glyph record and one text position and color per instance
+                glBindBuffer(GL_ARRAY_BUFFER, stream.glyphVBO);
+                FontImpl::setInstanceAttribs(program);
+                glBindBuffer(GL_ARRAY_BUFFER, stream.textVBO);
+                glEnableVertexAttribArray(program.mInstancedTextPositionAttrib);
+                glEnableVertexAttribArray(program.mInstancedTextColorAttrib);
+                glVertexAttribPointer(program.mInstancedTextPositionAttrib, 2, GL_FLOAT, GL_FALSE, sizeof(TextVertex), 0); // NOLINT
+                glVertexAttribPointer(program.mInstancedTextColorAttrib, 3, GL_FLOAT, GL_FALSE, sizeof(TextVertex), reinterpret_cast<GLvoid*>(2 * sizeof(GLfloat))); // NOLINT
+                glVertexAttribDivisor(program.mInstancedTextPositionAttrib, 1);
+                glVertexAttribDivisor(program.mInstancedTextColorAttrib, 1);
+            } else {
+                glBindBuffer(GL_ARRAY_BUFFER, stream.glyphVBO);
+                FontImpl::setVertexAttribs(program);
+                glBindBuffer(GL_ARRAY_BUFFER, stream.textVBO);
+                glEnableVertexAttribArray(program.mBatchTextPositionAttrib);
+                glEnableVertexAttribArray(program.mBatchTextColorAttrib);
+                glVertexAttribPointer(program.mBatchTextPositionAttrib, 2, GL_FLOAT, GL_FALSE, sizeof(TextVertex), 0);
+                glVertexAttribPointer(program.mBatchTextColorAttrib, 3, GL_FLOAT, GL_FALSE, sizeof(TextVertex), reinterpret_cast<GLvoid*>(2 * sizeof(GLfloat))); // NOLINT
+            }
+            GL_CHECK();
+            mStreams.push_back(stream);
+        }
+        entryStreams[e] = s;
+        mStreams[s].nbGlyphs += mEntries[e].text->getLength();
+    }
+
+    // Release the streams not used anymore, with their reference to the font
+    for (size_t s = 0; s < mStreams.size(); ) {
+        if (0 == mStreams[s].nbGlyphs) {
+            glDeleteVertexArrays(1, &mStreams[s].vao);
+            glDeleteBuffers(1, &mStreams[s].glyphVBO);
+            glDeleteBuffers(1, &mStreams[s].textVBO);
+            mStreams.erase(mStreams.begin() + s);
+            for (size_t e = 0; e < mEntries.size(); ++e) {
+                if (entryStreams[e] > s) {
+                    --entryStreams[e];
+                }
+            }
+        } else {
+            ++s;
+        }
+    }
+
+    // Grow the buffers of the streams when needed, at least doubling their capacity
+    for (size_t s = 0; s < mStreams.size(); ++s) {
+        Stream& stream = mStreams[s];
+        if (stream.capacity < stream.nbGlyphs) {
+            stream.capacity = (stream.nbGlyphs > 2 * stream.capacity) ? stream.nbGlyphs : 2 * stream.capacity;
+            glBindVertexArray(stream.vao);
+            if (!stream.instanced) {
+                // The shared index buffer switches to 32 bits indices when the stream grows past 16384 glyphs
+                stream.indexType = QuadIndexBuffer::getInstance().bind(stream.capacity);
+            }
+            glBindBuffer(GL_ARRAY_BUFFER, stream.glyphVBO);
+            glBufferData(GL_ARRAY_BUFFER, stream.capacity * getGlyphSize(stream), NULL, GL_STATIC_DRAW);
+            glBindBuffer(GL_ARRAY_BUFFER, stream.textVBO);
+            glBufferData(GL_ARRAY_BUFFER, stream.capacity * getNbTextVertices(stream) * sizeof(TextVertex), NULL,
+                         GL_STATIC_DRAW);
+            GL_CHECK();
+        }
+    }
+
+    // Copy the glyphs of each text into its stream on the GPU side, and fill the position and color of its vertices
+    std::vector<size_t> nbCopiedGlyphs(mStreams.size(), 0);
+    std::vector<std::vector<TextVertex> > textVertices(mStreams.size());
+    for (size_t s = 0; s < mStreams.size(); ++s) {
+        textVertices[s].reserve(mStreams[s].nbGlyphs * getNbTextVertices(mStreams[s]));
+    }
+    for (size_t e = 0; e < mEntries.size(); ++e) {
+        const size_t s = entryStreams[e];
+        const size_t length = mEntries[e].text->getLength();
+        if (0 < length) {
+            const size_t glyphSize = getGlyphSize(mStreams[s]);
+            glBindBuffer(GL_COPY_READ_BUFFER, mEntries[e].text->getVBO());
+            glBindBuffer(GL_COPY_WRITE_BUFFER, mStreams[s].glyphVBO);
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, mEntries[e].text->getVBOOffset(),
+                                nbCopiedGlyphs[s] * glyphSize, length * glyphSize);
+            nbCopiedGlyphs[s] += length;
+
+            const TextVertex textVertex = {mEntries[e].x, mEntries[e].y,
+                                           mEntries[e].red, mEntries[e].green, mEntries[e].blue};
+            textVertices[s].insert(textVertices[s].end(), length * getNbTextVertices(mStreams[s]), textVertex);
+        }
+    }
+    for (size_t s = 0; s < mStreams.size(); ++s) {
+        glBindBuffer(GL_ARRAY_BUFFER, mStreams[s].textVBO);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, textVertices[s].size() * sizeof(TextVertex), &textVertices[s][0]);
+    }
+    GL_CHECK();
+}
+
+// Size of the data of one glyph in the stream, that is the four vertices of its quad or its instance record.
+size_t TextBatchImpl::getGlyphSize(const Stream& aStream) {
+    return aStream.instanced ? FontImpl::getGlyphInstanceSize() : FontImpl::getGlyphVerticiesSize();
+}
+
+// Number of text positions and colors needed per glyph in the stream, that is one per vertex or per instance.
+size_t TextBatchImpl::getNbTextVertices(const Stream& aStream) {
+    return aStream.instanced ? 1 : 4;
+}
+
+} // namespace gltext
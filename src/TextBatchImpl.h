@@ -0,0 +1,120 @@
+/**
+ * @file    TextBatchImpl.h
+ * @brief   Private Implementation of a collection of many texts drawn together.
+ *
+ * Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <memory>       // for std::shared_ptr
+#include <vector>
+
+#include "glload.hpp"   // OpenGL types & function pointers
+
+namespace gltext {
+
+class FontImpl;
+class TextImpl;
+
+/**
+ * @brief Private Implementation of a collection of many texts drawn together.
+ *
+ * @see the TextBatch class for detailed explanation
+ */
+class TextBatchImpl {
+public:
+    /**
+     * @brief Create an empty batch.
+     */
+    TextBatchImpl();
+    /**
+     * @brief Cleanup all OpenGL ressources.
+     */
+    ~TextBatchImpl();
+
+    /**
+     * @brief Add a text to the batch, to be drawn at the given position with the given color.
+     *
+     * @see TextBatch::add() for detailed explanation
+     */
+    void add(const std::shared_ptr<TextImpl>& aTextImplPtr, float aX, float aY, float aRed, float aGreen, float aBlue);
+
+    /**
+     * @brief Remove all the texts from the batch.
+     */
+    void clear();
+
+    /**
+     * @brief Set the offset and the scale converting the positions of the texts, in pixels, to OpenGL clip coordinates.
+     *
+     * @see TextBatch::setTransform() for detailed explanation
+     */
+    void setTransform(float aOffsetX, float aOffsetY, float aScaleX, float aScaleY);
+
+    /**
+     * @brief Ask OpenGL to draw all the texts of the batch, with one draw call per cache texture.
+     */
+    void draw();
+
+private:
+    /**
+     * @brief Rebuild the vertex streams of all the cache textures from the texts of the batch.
+     */
+    void build();
+
+private:
+    /// A text of the batch, with its position and color
+    struct Entry {
+        std::shared_ptr<TextImpl>   text;   ///< Text to draw
+        GLfloat                     x;      ///< X coordinate of where to start drawing the text
+        GLfloat                     y;      ///< Y coordinate of where to start drawing the text
+        GLfloat                     red;    ///< Red component of the color of the text
+        GLfloat                     green;  ///< Green component of the color of the text
+        GLfloat                     blue;   ///< Blue component of the color of the text
+    };
+
+    /// Position and color of the text of a vertex (or of a glyph instance)
+    struct TextVertex {
+        GLfloat x;      ///< X coordinate of where to start drawing the text
+        GLfloat y;      ///< Y coordinate of where to start drawing the text
+        GLfloat red;    ///< Red component of the color of the text
+        GLfloat green;  ///< Green component of the color of the text
+        GLfloat blue;   ///< Blue component of the color of the text
+    };
+
+    /// Vertex stream of all the texts sharing a cache texture, and either stored as quads or as instances
+    struct Stream {
+        std::shared_ptr<const FontImpl> font;       ///< Font owning the cache texture
+        bool                            instanced;  ///< Are the glyphs stored as one instance each, without indices ?
+        size_t                          nbGlyphs;   ///< Number of glyphs in the stream
+        size_t                          capacity;   ///< Number of glyphs allocated in the buffers
+        GLuint                          vao;        ///< Vertex Array Object used to draw the stream
+        GLuint                          glyphVBO;   ///< Vertex Buffer Object of the glyphs, copied from the texts
+        GLuint                          textVBO;    ///< Vertex Buffer Object of the position and color of the texts
+        GLenum                          indexType;  ///< Type of the shared indices of the glyphs (0 if instanced)
+    };
+
+    /**
+     * @brief Size of the data of one glyph in the stream, that is the four vertices of its quad or its instance record.
+     */
+    static size_t getGlyphSize(const Stream& aStream);
+
+    /**
+     * @brief Number of text positions and colors needed per glyph in the stream, that is one per vertex or per instance.
+     */
+    static size_t getNbTextVertices(const Stream& aStream);
+
+private:
+    std::vector<Entry>  mEntries;   ///< Texts of the batch, in the order they were added
+    std::vector<Stream> mStreams;   ///< Vertex stream of each cache texture, in the order of their first text
+    GLfloat             mOffsetX;   ///< Horizontal offset added to the positions, in pixels
+    GLfloat             mOffsetY;   ///< Vertical offset added to the positions, in pixels
+    GLfloat             mScaleX;    ///< Horizontal scale from offset positions to clip coordinates
+    GLfloat             mScaleY;    ///< Vertical scale from offset positions to clip coordinates
+    bool                mbDirty;    ///< Are the streams to be rebuilt before the next draw ?
+};
+
+} // namespace gltext
@@ -23,20 +23,46 @@ TextImpl::TextImpl(const std::shared_ptr<const FontImpl>&   aFontImplPtr,
                    size_t                                   aTextLength,
                    size_t                                   aTextVAO,
                    size_t                                   aTextVBO,
-                   size_t                                   aTextIBO) :
+                   unsigned int                             aIndexType,
+                   bool                                     abInstanced) :
     mFontImplPtr(aFontImplPtr),
     mTextLength(aTextLength),
     mTextVAO(aTextVAO),
     mTextVBO(aTextVBO),
-    mTextIBO(aTextIBO) {
+    mIndexType(aIndexType),
+    mbInstanced(abInstanced),
+    mpSlice(NULL),
+    mOffsetX(-200.0f),
+    mOffsetY(-200.0f),
+    mScaleX(1/256.0f),
+    mScaleY(1/256.0f) {
+}
+
+// Encapsulate a text rendered into a slice of the VertexArena, drawn with the VAO of its block.
+TextImpl::TextImpl(const std::shared_ptr<const FontImpl>& aFontImplPtr, VertexArena::Slice* apSlice) :
+    mFontImplPtr(aFontImplPtr),
+    mTextLength(apSlice->count),
+    mTextVAO(0),
+    mTextVBO(0),
+    mIndexType(GL_UNSIGNED_SHORT),
+    mbInstanced(false),
+    mpSlice(apSlice),
+    mArenaPtr(VertexArena::getInstance()),
+    mOffsetX(-200.0f),
+    mOffsetY(-200.0f),
+    mScaleX(1/256.0f),
+    mScaleY(1/256.0f) {
 }
 
 // Private Implementation of a static/constant text rendered with Freetype, ready to be drawn with OpenGL..
 TextImpl::~TextImpl() {
     // releases mFontImplPtr
-    glDeleteVertexArrays(1, &mTextVAO);
-    glDeleteBuffers(1, &mTextVBO);
-    glDeleteBuffers(1, &mTextIBO);
+    if (NULL != mpSlice) {
+        mArenaPtr->free(mpSlice);
+    } else {
+        glDeleteVertexArrays(1, &mTextVAO);
+        glDeleteBuffers(1, &mTextVBO);
+    }
 }
 
 // Initialize the 3D position where to start to draw the text.
@@ -44,26 +70,70 @@ void TextImpl::setPosition(float aX, float aY, float aZ) {
     assert(mFontImplPtr);
 }
 
+// Set the offset and the scale converting the positions of the glyphs, in pixels, to OpenGL clip coordinates.
+void TextImpl::setTransform(float aOffsetX, float aOffsetY, float aScaleX, float aScaleY) {
+    mOffsetX = aOffsetX;
+    mOffsetY = aOffsetY;
+    mScaleX = aScaleX;
+    mScaleY = aScaleY;
+}
+
 // Ask OpenGL to draw the pre-rendered static text, using the current binded program, at current position.
 void TextImpl::draw() {
     assert(mFontImplPtr);
 
     Program& program = Program::getInstance();
+    if (mbInstanced) {
+        drawInstanced(program);
+        return;
+    }
     glUseProgram(program.mProgram);
 
+    glUniform2f(program.mOffsetUnif, mOffsetX, mOffsetY);
+    glUniform2f(program.mScaleUnif, mScaleX, mScaleY);
     // TODO remove this, shall be down outside of this method
-    glUniform2f(program.mOffsetUnif, -200.0f, -200.0f);
-    glUniform2f(program.mScaleUnif, 1/256.0f, 1/256.0f);
     glUniform3f(program.mColorUnif, 1.0f, 1.0f, 0.0f);
 
     glActiveTexture(GL_TEXTURE0 + _TextureUnitIdx);
-    glBindTexture(GL_TEXTURE_2D, mFontImplPtr->mCacheTexture);
+    glBindTexture(GL_TEXTURE_2D, mFontImplPtr->getCacheTexture());
+    // Bind to sampler name zero == the currently bound texture's sampler state becomes active (no dedicated sampler)
+    glBindSampler(_TextureUnitIdx, 0);
+
+    // Draw the rendered text, from its slice of the arena (the base vertex being added to the shared indices)
+    if (NULL != mpSlice) {
+        if (NULL != mpSlice->pBlock) {
+            glBindVertexArray(mpSlice->pBlock->vao);
+            glDrawElementsBaseVertex(GL_TRIANGLES, mTextLength * 6, mIndexType, 0, mpSlice->offset * 4);
+        }
+    } else {
+        glBindVertexArray(mTextVAO);
+        glDrawElements(GL_TRIANGLES, mTextLength * 6, mIndexType, 0);
+    }
+}
+
+// Get the offset of the glyphs of the text in its Vertex Buffer Object, in bytes.
+size_t TextImpl::getVBOOffset() const {
+    return (NULL != mpSlice) ? mpSlice->offset * FontImpl::getGlyphVerticiesSize() : 0;
+}
+
+// Draw the text stored as one instance per glyph, each one expanded into a quad by the instanced program.
+void TextImpl::drawInstanced(Program& aProgram) {
+    glUseProgram(aProgram.mInstancedProgram);
+
+    glUniform2f(aProgram.mInstancedOffsetUnif, mOffsetX, mOffsetY);
+    glUniform2f(aProgram.mInstancedScaleUnif, mScaleX, mScaleY);
+    // Position and color of the text are constant attributes, since they are not streamed by the VAO of a lone text
+    glVertexAttrib2f(aProgram.mInstancedTextPositionAttrib, 0.0f, 0.0f);
+    glVertexAttrib3f(aProgram.mInstancedTextColorAttrib, 1.0f, 1.0f, 0.0f);
+
+    glActiveTexture(GL_TEXTURE0 + _TextureUnitIdx);
+    glBindTexture(GL_TEXTURE_2D, mFontImplPtr->getCacheTexture());
     // Bind to sampler name zero == the currently bound texture's sampler state becomes active (no dedicated sampler)
     glBindSampler(_TextureUnitIdx, 0);
 
-    // Draw the rendered text
+    // Draw the 4 vertices of the triangle strip of each glyph
     glBindVertexArray(mTextVAO);
-    glDrawElements(GL_TRIANGLES, mTextLength * 6, GL_UNSIGNED_SHORT, 0);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, mTextLength);
 }
 
 } // namespace gltext
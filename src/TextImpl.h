@@ -12,10 +12,12 @@
 #include <memory>       // for std::shared_ptr
 
 #include "glload.hpp"   // OpenGL types & function pointers
+#include "VertexArena.h"    // NOLINT TODO
 
 namespace gltext {
 
 class FontImpl;
+class Program;
 
 /**
  * @brief Private Implementation of a static/constant text rendered with Freetype, ready to be drawn with OpenGL.
@@ -34,7 +36,8 @@ public:
      * @param[in] aTextLength   Size of text (number of unicode codepoint, number of glyphs in GL buffers).
      * @param[in] aTextVAO      Vertex Array Object used to render the text.
      * @param[in] aTextVBO      Vertex Buffer Object used to render the text.
-     * @param[in] aTextIBO      Index Buffer Object used to render the text.
+     * @param[in] aIndexType    OpenGL type of the shared indices of the glyphs (0 for an instanced text).
+     * @param[in] abInstanced   Is the text stored as one instance per glyph, drawn without any index buffer ?
      *
      * @see Text::Text() for detailed explanation
      */
@@ -42,7 +45,15 @@ public:
                       size_t                                    aTextLength,
                       size_t                                    aTextVAO,
                       size_t                                    aTextVBO,
-                      size_t                                    aTextIBO);
+                      unsigned int                              aIndexType,
+                      bool                                      abInstanced = false);
+    /**
+     * @brief Encapsulate a text rendered into a slice of the VertexArena, drawn with the VAO of its block.
+     *
+     * @param[in] aFontImplPtr  Shared pointer to the Font implementation from which this Text is build.
+     * @param[in] apSlice       Slice of the arena holding the glyphs of the text, released with the text.
+     */
+    TextImpl(const std::shared_ptr<const FontImpl>& aFontImplPtr, VertexArena::Slice* apSlice);
     /**
      * @brief Cleanup
      */
@@ -61,6 +72,13 @@ public:
      */
     void setPosition(float aX, float aY, float aZ);
 
+    /**
+     * @brief Set the offset and the scale converting the positions of the glyphs, in pixels, to OpenGL clip coordinates.
+     *
+     * @see Text::setTransform() for detailed explanation
+     */
+    void setTransform(float aOffsetX, float aOffsetY, float aScaleX, float aScaleY);
+
     /**
      * @brief Ask OpenGL to draw the pre-rendered static text, using the current binded program, at current position.
      *
@@ -68,6 +86,43 @@ public:
      */
     void draw();
 
+    /**
+     * @brief Get the Font implementation from which this Text is build, owning the cache texture it uses.
+     */
+    inline const std::shared_ptr<const FontImpl>& getFontImpl() const {
+        return mFontImplPtr;
+    }
+    /**
+     * @brief Get the size of text (number of glyphs in GL buffers).
+     */
+    inline size_t getLength() const {
+        return mTextLength;
+    }
+    /**
+     * @brief Get the Vertex Buffer Object holding the vertex and texture coordinates of the glyphs of the text.
+     */
+    inline GLuint getVBO() const {
+        return (NULL != mpSlice) ? ((NULL != mpSlice->pBlock) ? mpSlice->pBlock->vbo : 0) : mTextVBO;
+    }
+    /**
+     * @brief Get the offset of the glyphs of the text in its Vertex Buffer Object, in bytes.
+     */
+    size_t getVBOOffset() const;
+    /**
+     * @brief Is the text stored as one instance per glyph (rectangles instead of the four vertices of a quad) ?
+     */
+    inline bool isInstanced() const {
+        return mbInstanced;
+    }
+
+private:
+    /**
+     * @brief Draw the text stored as one instance per glyph, each one expanded into a quad by the instanced program.
+     *
+     * @param[in] aProgram  Shaders program singleton.
+     */
+    void drawInstanced(Program& aProgram);
+
 private:
     /**
      * @brief Private Implementation of the Freetype / HarfBuzz Font rendering
@@ -82,9 +137,16 @@ private:
 
     size_t mTextLength;                 ///< Size of text (number of unicode codepoint, number of glyphs in GL buffers)
 
-    GLuint mTextVAO;                    ///< Vertex Array Object used to render the text
-    GLuint mTextVBO;                    ///< Vertex Buffer Object used to render the text
-    GLuint mTextIBO;                    ///< Index Buffer Object used to render the text
+    GLuint mTextVAO;                    ///< Vertex Array Object used to render the text (0 in the arena)
+    GLuint mTextVBO;                    ///< Vertex Buffer Object used to render the text (0 in the arena)
+    GLenum mIndexType;                  ///< OpenGL type of the shared indices of the glyphs (0 if instanced)
+    bool   mbInstanced;                 ///< Is the text stored as one instance per glyph, without index buffer ?
+    VertexArena::Slice* mpSlice;        ///< Slice of the arena holding the glyphs (NULL for dedicated buffers)
+    std::shared_ptr<VertexArena> mArenaPtr; ///< Arena of the slice, kept alive until the slice is freed (or NULL)
+    GLfloat mOffsetX;                   ///< Horizontal offset added to the positions, in pixels
+    GLfloat mOffsetY;                   ///< Vertical offset added to the positions, in pixels
+    GLfloat mScaleX;                    ///< Horizontal scale from offset positions to clip coordinates
+    GLfloat mScaleY;                    ///< Vertical scale from offset positions to clip coordinates
 };
 
 } // namespace gltext
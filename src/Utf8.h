@@ -0,0 +1,72 @@
+/**
+ * @file    Utf8.h
+ * @brief   Decoding of UTF-8 encoded strings of characters, for the text layouts not done by HarfBuzz.
+ *
+ * Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+
+namespace gltext {
+
+/**
+ * @brief Decode the UTF-8 character starting at the given offset.
+ *
+ * @param[in]  aCharacters  UTF-8 encoded string of characters.
+ * @param[in]  aOffset      Offset of the first byte of the character.
+ * @param[out] aNext        Offset of the first byte of the next character.
+ *
+ * @return Unicode codepoint of the character, or U+FFFD for an invalid byte sequence (skipping only its first byte).
+ */
+inline uint32_t decodeUtf8(const std::string& aCharacters, size_t aOffset, size_t& aNext) {
+    const unsigned char first = static_cast<unsigned char>(aCharacters[aOffset]);
+    size_t          length;
+    uint32_t        codepoint;
+    uint32_t        minimum;
+    if (first < 0x80) {
+        aNext = aOffset + 1;
+        return first;
+    } else if ((first & 0xE0) == 0xC0) {
+        length = 2;
+        codepoint = first & 0x1F;
+        minimum = 0x80;
+    } else if ((first & 0xF0) == 0xE0) {
+        length = 3;
+        codepoint = first & 0x0F;
+        minimum = 0x800;
+    } else if ((first & 0xF8) == 0xF0) {
+        length = 4;
+        codepoint = first & 0x07;
+        minimum = 0x10000;
+    } else {
+        aNext = aOffset + 1;
+        return 0xFFFD;
+    }
+    if (aOffset + length > aCharacters.size()) {
+        aNext = aOffset + 1;
+        return 0xFFFD;
+    }
+    for (size_t i = 1; i < length; ++i) {
+        const unsigned char next = static_cast<unsigned char>(aCharacters[aOffset + i]);
+        if ((next & 0xC0) != 0x80) {
+            aNext = aOffset + 1;
+            return 0xFFFD;
+        }
+        codepoint = (codepoint << 6) | (next & 0x3F);
+    }
+    // Reject overlong forms, surrogates and codepoints out of the Unicode range
+    if ((codepoint < minimum) || (codepoint > 0x10FFFF) || ((codepoint >= 0xD800) && (codepoint <= 0xDFFF))) {
+        aNext = aOffset + 1;
+        return 0xFFFD;
+    }
+    aNext = aOffset + length;
+    return codepoint;
+}
+
+} // namespace gltext
@@ -0,0 +1,221 @@
+/**
+ * @file    VertexArena.cpp
+ * @brief   Sub-allocator of the glyph vertices of all texts into a few large Vertex Buffer Objects.
+ *
+ * Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "VertexArena.h"        // NOLINT TODO
+#include "QuadIndexBuffer.h"    // NOLINT TODO
+#include "FontImpl.h"           // NOLINT TODO
+#include "Program.h"            // NOLINT TODO
+
+#include <cassert>
+#include <map>
+#include <vector>
+
+namespace gltext {
+
+const size_t VertexArena::BLOCK_GLYPHS;
+
+// Constructor, creating the blocks on first use only
+VertexArena::VertexArena() {
+}
+
+// Destructor, releasing the blocks and any remaining slice
+VertexArena::~VertexArena() {
+    // as for the Program, the OpenGL context is already gone at exit: only release the memory
+    for (size_t b = 0; b < mBlocks.size(); ++b) {
+        std::map<size_t, Slice*>::iterator iSlice;
+        for (iSlice = mBlocks[b]->slices.begin(); iSlice != mBlocks[b]->slices.end(); ++iSlice) {
+            delete iSlice->second;
+        }
+        delete mBlocks[b];
+    }
+}
+
+// Allocate a slice of the given number of glyphs, creating a new block if none has enough free space.
+VertexArena::Slice* VertexArena::allocate(size_t aNbGlyphs) {
+    assert(aNbGlyphs <= BLOCK_GLYPHS);
+
+    Slice* pSlice = new Slice();
+    pSlice->pBlock = NULL;
+    pSlice->offset = 0;
+    pSlice->count = aNbGlyphs;
+    if (0 == aNbGlyphs) {
+        return pSlice;
+    }
+
+    // First fit, in the order of creation of the blocks
+    for (size_t b = 0; (b < mBlocks.size()) && (NULL == pSlice->pBlock); ++b) {
+        std::map<size_t, size_t>::iterator iFree = mBlocks[b]->free.begin();
+        while ((iFree != mBlocks[b]->free.end()) && (iFree->second < aNbGlyphs)) {
+            ++iFree;
+        }
+        if (iFree != mBlocks[b]->free.end()) {
+            pSlice->pBlock = mBlocks[b];
+            pSlice->offset = iFree->first;
+        }
+    }
+    if (NULL == pSlice->pBlock) {
+        pSlice->pBlock = createBlock();
+        pSlice->offset = 0;
+    }
+
+    // Take the beginning of the free range
+    Block* pBlock = pSlice->pBlock;
+    const size_t freeCount = pBlock->free[pSlice->offset];
+    pBlock->free.erase(pSlice->offset);
+    if (freeCount > aNbGlyphs) {
+        pBlock->free[pSlice->offset + aNbGlyphs] = freeCount - aNbGlyphs;
+    }
+    pBlock->slices[pSlice->offset] = pSlice;
+
+    // The shared index buffer may need to grow (keeping its name, so the VAO of the block stays valid)
+    glBindVertexArray(pBlock->vao);
+    QuadIndexBuffer::getInstance().bind(aNbGlyphs);
+
+    return pSlice;
+}
+
+// Release a slice, and its block if it is left empty and is not the last one.
+void VertexArena::free(Slice* apSlice) {
+    Block* pBlock = apSlice->pBlock;
+    if (NULL != pBlock) {
+        pBlock->slices.erase(apSlice->offset);
+
+        // Merge the released range with the free ranges just before and just after it
+        size_t offset = apSlice->offset;
+        size_t count = apSlice->count;
+        std::map<size_t, size_t>::iterator iNext = pBlock->free.lower_bound(offset);
+        if ((iNext != pBlock->free.end()) && (offset + count == iNext->first)) {
+            count += iNext->second;
+            std::map<size_t, size_t>::iterator iMerged = iNext;
+            ++iNext;
+            pBlock->free.erase(iMerged);
+        }
+        if (iNext != pBlock->free.begin()) {
+            std::map<size_t, size_t>::iterator iPrevious = iNext;
+            --iPrevious;
+            if (iPrevious->first + iPrevious->second == offset) {
+                offset = iPrevious->first;
+                count += iPrevious->second;
+            }
+        }
+        pBlock->free[offset] = count;
+
+        if (pBlock->slices.empty() && (mBlocks.size() > 1)) {
+            size_t b = 0;
+            while (mBlocks[b] != pBlock) {
+                ++b;
+            }
+            mBlocks.erase(mBlocks.begin() + b);
+            deleteBlock(pBlock);
+        }
+    }
+    delete apSlice;
+}
+
+// Move all the slices at the beginning of as few blocks as possible, and release the other blocks.
+void VertexArena::compact() {
+    // Leading blocks already packed would be copied as they are: keep them, and only move the following ones
+    size_t nbPacked = 0;
+    while ((nbPacked < mBlocks.size()) && isPacked(nbPacked)) {
+        ++nbPacked;
+    }
+    if (nbPacked == mBlocks.size()) {
+        return;
+    }
+
+    const size_t glyphSize = FontImpl::getGlyphVerticiesSize();
+    std::vector<Block*> oldBlocks(mBlocks.begin() + nbPacked, mBlocks.end());
+    mBlocks.resize(nbPacked);
+
+    // Copy the slices one after the other into new blocks, in the order of their current location
+    Block* pBlock = NULL;
+    size_t cursor = 0;
+    for (size_t b = 0; b < oldBlocks.size(); ++b) {
+        std::map<size_t, Slice*>::iterator iSlice;
+        for (iSlice = oldBlocks[b]->slices.begin(); iSlice != oldBlocks[b]->slices.end(); ++iSlice) {
+            Slice* pSlice = iSlice->second;
+            if ((NULL == pBlock) || (cursor + pSlice->count > BLOCK_GLYPHS)) {
+                if ((NULL != pBlock) && (cursor < BLOCK_GLYPHS)) {
+                    pBlock->free[cursor] = BLOCK_GLYPHS - cursor;
+                }
+                pBlock = createBlock();
+                pBlock->free.clear();
+                cursor = 0;
+            }
+            glBindBuffer(GL_COPY_READ_BUFFER, oldBlocks[b]->vbo);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, pBlock->vbo);
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+                                pSlice->offset * glyphSize, cursor * glyphSize, pSlice->count * glyphSize);
+            pSlice->pBlock = pBlock;
+            pSlice->offset = cursor;
+            pBlock->slices[cursor] = pSlice;
+            cursor += pSlice->count;
+        }
+    }
+    if ((NULL != pBlock) && (cursor < BLOCK_GLYPHS)) {
+        pBlock->free[cursor] = BLOCK_GLYPHS - cursor;
+    }
+    GL_CHECK();
+
+    for (size_t b = 0; b < oldBlocks.size(); ++b) {
+        deleteBlock(oldBlocks[b]);
+    }
+}
+
+// Is the given block already laid out as compact() would do it ?
+bool VertexArena::isPacked(size_t aBlock) const {
+    const Block* pBlock = mBlocks[aBlock];
+    if (pBlock->slices.empty()) {
+        return false;
+    }
+    // Slices contiguous from the beginning leave at most one free range, at the end of the block
+    size_t freeCount = 0;
+    if (!pBlock->free.empty()) {
+        const std::map<size_t, size_t>::const_iterator iFree = pBlock->free.begin();
+        if ((1 < pBlock->free.size()) || (iFree->first + iFree->second != BLOCK_GLYPHS)) {
+            return false;
+        }
+        freeCount = iFree->second;
+    }
+    // and compacting would move the first slice of the next block into this free range
+    if (aBlock + 1 < mBlocks.size()) {
+        const Block* pNextBlock = mBlocks[aBlock + 1];
+        if (!pNextBlock->slices.empty() && (pNextBlock->slices.begin()->second->count <= freeCount)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Create a new empty block, with its VBO and its VAO bound to the shared QuadIndexBuffer.
+VertexArena::Block* VertexArena::createBlock() {
+    Program& program = Program::getInstance();
+    Block* pBlock = new Block();
+    glGenVertexArrays(1, &pBlock->vao);
+    glGenBuffers(1, &pBlock->vbo);
+    glBindVertexArray(pBlock->vao);
+    glBindBuffer(GL_ARRAY_BUFFER, pBlock->vbo);
+    glBufferData(GL_ARRAY_BUFFER, BLOCK_GLYPHS * FontImpl::getGlyphVerticiesSize(), NULL, GL_STATIC_DRAW);
+    FontImpl::setVertexAttribs(program);
+    QuadIndexBuffer::getInstance().bind(1);
+    GL_CHECK();
+    pBlock->free[0] = BLOCK_GLYPHS;
+    mBlocks.push_back(pBlock);
+    return pBlock;
+}
+
+// Release the VBO and the VAO of a block.
+void VertexArena::deleteBlock(Block* apBlock) {
+    glDeleteVertexArrays(1, &apBlock->vao);
+    glDeleteBuffers(1, &apBlock->vbo);
+    delete apBlock;
+}
+
+} // namespace gltext
@@ -0,0 +1,127 @@
+/**
+ * @file    VertexArena.h
+ * @brief   Sub-allocator of the glyph vertices of all texts into a few large Vertex Buffer Objects.
+ *
+ * Copyright (c) 2014 Sebastien Rombauts (sebastien.rombauts@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "glload.hpp"   // OpenGL types & function pointers
+
+namespace gltext {
+
+/**
+ * @brief Sub-allocator of the glyph vertices of all texts into a few large Vertex Buffer Objects.
+ *
+ *  Creating a Vertex Array Object and a Vertex Buffer Object for each Text churns driver objects and fragments
+ * the video memory when many short-lived texts are assembled. Instead, the arena allocates blocks of
+ * BLOCK_GLYPHS glyphs, each one with its own VBO and a VAO shared by all the texts it holds,
+ * and gives each text a slice of a block, that is an offset and a number of glyphs.
+ * Texts are then drawn with glDrawElementsBaseVertex() from the shared QuadIndexBuffer.
+ *
+ *  Freed slices are merged with their free neighbours, and blocks left empty are released, but one.
+ * compact() moves all the slices at the beginning of as few blocks as possible.
+ *
+ *  Each text holding a slice keeps a reference to the arena, which is thus only destroyed after the last of them,
+ * even for texts destroyed at exit after the static instance.
+ *
+ *  As for any OpenGL object, it must only be used from the thread owning the OpenGL context.
+ */
+class VertexArena {
+public:
+    /// Number of glyphs of a block, that is the maximum length of a text sub-allocated into the arena
+    static const size_t BLOCK_GLYPHS = 16384;
+
+    struct Slice;
+
+    /// A Vertex Buffer Object, with the Vertex Array Object used to draw the slices it holds
+    struct Block {
+        GLuint                      vao;    ///< Vertex Array Object shared by the texts of the block
+        GLuint                      vbo;    ///< Vertex Buffer Object of BLOCK_GLYPHS glyphs
+        std::map<size_t, Slice*>    slices; ///< Allocated slices, by offset
+        std::map<size_t, size_t>    free;   ///< Free ranges of glyphs, number of glyphs by offset
+    };
+
+    /// Range of glyphs allocated to a text
+    struct Slice {
+        Block*  pBlock; ///< Block holding the glyphs (NULL for an empty text)
+        size_t  offset; ///< Index of the first glyph in the block
+        size_t  count;  ///< Number of glyphs
+    };
+
+    /**
+     * @brief Allocate a slice of the given number of glyphs, creating a new block if none has enough free space.
+     *
+     *  Binds the Vertex Array Object of the block, and makes sure the shared QuadIndexBuffer indexes enough glyphs.
+     *
+     * @param[in] aNbGlyphs Number of glyphs to allocate, up to BLOCK_GLYPHS.
+     *
+     * @return New slice, to be released with free()
+     */
+    Slice* allocate(size_t aNbGlyphs);
+
+    /**
+     * @brief Release a slice, and its block if it is left empty and is not the last one.
+     *
+     * @param[in] apSlice   Slice to release, obtained from allocate().
+     */
+    void free(Slice* apSlice);
+
+    /**
+     * @brief Move all the slices at the beginning of as few blocks as possible, and release the other blocks.
+     *
+     *  Slices are updated in place, so texts draw from their new location without any change.
+     * The leading blocks already packed are left untouched, so it does nothing when the arena is already compact.
+     */
+    void compact();
+
+    /**
+     * @brief Get instance of the singleton
+     *
+     * @return shared pointer to the instance of the singleton, to be kept by the texts holding a slice
+     */
+    static const std::shared_ptr<VertexArena>& getInstance() {
+        static std::shared_ptr<VertexArena> _arenaPtr(new VertexArena(), [](VertexArena* apArena) {
+            delete apArena;
+        });
+        return _arenaPtr;
+    }
+
+private:
+    /// Constructor, creating the blocks on first use only
+    VertexArena();
+    /// Destructor, releasing the blocks and any remaining slice
+    ~VertexArena();
+
+    /**
+     * @brief Create a new empty block, with its VBO and its VAO bound to the shared QuadIndexBuffer.
+     */
+    Block* createBlock();
+
+    /**
+     * @brief Is the given block already laid out as compact() would do it ?
+     *
+     *  That is, its slices are contiguous from its beginning, and the first slice of the next block
+     * does not fit into the rest of it.
+     *
+     * @param[in] aBlock    Index of the block in mBlocks.
+     */
+    bool isPacked(size_t aBlock) const;
+
+    /**
+     * @brief Release the VBO and the VAO of a block.
+     */
+    static void deleteBlock(Block* apBlock);
+
+private:
+    std::vector<Block*> mBlocks;    ///< All the blocks, in the order of their creation
+};
+
+} // namespace gltext
@@ -54,8 +54,14 @@ PFNGLBINDBUFFERPROC glBindBuffer;
 PFNGLDELETEBUFFERSPROC glDeleteBuffers;
 PFNGLBUFFERDATAPROC glBufferData;
 PFNGLBUFFERSUBDATAPROC glBufferSubData;
+PFNGLCOPYBUFFERSUBDATAPROC glCopyBufferSubData;
 PFNGLENABLEVERTEXATTRIBARRAYPROC glEnableVertexAttribArray;
 PFNGLVERTEXATTRIBPOINTERPROC glVertexAttribPointer;
+PFNGLVERTEXATTRIBDIVISORPROC glVertexAttribDivisor;
+PFNGLVERTEXATTRIB2FPROC glVertexAttrib2f;
+PFNGLVERTEXATTRIB3FPROC glVertexAttrib3f;
+PFNGLDRAWARRAYSINSTANCEDPROC glDrawArraysInstanced;
+PFNGLDRAWELEMENTSBASEVERTEXPROC glDrawElementsBaseVertex;
 PFNGLCREATESHADERPROC glCreateShader;
 PFNGLSHADERSOURCEPROC glShaderSource;
 PFNGLCOMPILESHADERPROC glCompileShader;
@@ -96,8 +102,14 @@ void initGlPointers() {
     glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)glPointer("glDeleteBuffers");
     glBufferData = (PFNGLBUFFERDATAPROC)glPointer("glBufferData");
     glBufferSubData = (PFNGLBUFFERSUBDATAPROC)glPointer("glBufferSubData");
+    glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)glPointer("glCopyBufferSubData");
     glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)glPointer("glVertexAttribPointer");
     glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)glPointer("glEnableVertexAttribArray");
+    glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)glPointer("glVertexAttribDivisor");
+    glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)glPointer("glVertexAttrib2f");
+    glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)glPointer("glVertexAttrib3f");
+    glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)glPointer("glDrawArraysInstanced");
+    glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)glPointer("glDrawElementsBaseVertex");
     glCreateShader = (PFNGLCREATESHADERPROC)glPointer("glCreateShader");
     glShaderSource = (PFNGLSHADERSOURCEPROC)glPointer("glShaderSource");
     glCompileShader = (PFNGLCOMPILESHADERPROC)glPointer("glCompileShader");